@@ -0,0 +1,88 @@
+/****************************************************************************************
+ *  Memory Simulator: "Address.h"
+ *
+ *  Author:     Hannah Perkins
+ *  CWID:       11472559
+ *  Assignment: Lab #7
+ *
+ *  Date:       17 October 2026
+ *  Course:     ECE 487
+ *
+ *  Function:   Defines the main memory address type
+ *
+ *  Description: Main memory addresses and block numbers are 64-bit unsigned integers
+ *          (Address), so traces from 64-bit machines can be simulated with address
+ *          spaces of up to 2^64 bytes. Cache sizes, line numbers, and set numbers
+ *          stay int, since a cache always fits in far fewer lines.
+ *
+ *              A main memory size of 2^64 bytes does not fit in an Address, so a
+ *          size of 0 stands for the whole 2^64-byte space. ParseMemorySize accepts
+ *          "2^N" (including "2^64") as well as a plain number, and GetAddressBits
+ *          turns a size into the number of address lines.
+ *
+ ***************************************************************************************/
+
+#ifndef ADDRESS_H
+#define ADDRESS_H
+
+#include <string>
+#include <stdlib.h>
+using namespace std;
+
+// Main memory address or block number
+typedef unsigned long long Address;
+
+// Number of bits in an Address
+const int ADDRESS_BITS = 64;
+
+/****************************************************************************************
+ * Function Name:       GetAddressBits
+ * Input Parameters:    Address - represents the size of main memory in bytes (0 = 2^64)
+ * Return Value:        int - represents the number of address lines, log2 of the size
+ *                      rounded down
+ * Purpose:             Returns how many address bits main memory needs
+ ***************************************************************************************/
+inline int GetAddressBits(Address memorySize) {
+    // Whole 64-bit space
+    if(memorySize == 0) {
+        return ADDRESS_BITS;
+    }
+
+    // Position of the highest set bit
+    int bits = 0;
+    while((memorySize >> 1) != 0) {
+        memorySize = memorySize >> 1;
+        bits++;
+    }
+
+    return bits;
+}
+
+/****************************************************************************************
+ * Function Name:       ParseMemorySize
+ * Input Parameters:    string text - represents a size typed by the user, as a number
+ *                      (decimal, or hex with 0x) or as "2^N"
+ *                      Address &memorySize - set to the size in bytes (0 = 2^64)
+ * Return Value:        bool - represents whether the text was a valid size
+ * Purpose:             Reads a main memory size that may be too large to type out
+ ***************************************************************************************/
+inline bool ParseMemorySize(string text, Address &memorySize) {
+    // Temporary Variable for the end of the number
+    char* end;
+
+    // Power of two: "2^N" with N from 0 to 64
+    if(text.compare(0, 2, "2^") == 0) {
+        unsigned long long power = strtoull(text.c_str() + 2, &end, 10);
+        if((*end != '\0') || (end == text.c_str() + 2) || (power > ADDRESS_BITS)) {
+            return false;
+        }
+        memorySize = (power == ADDRESS_BITS) ? 0 : ((Address)1 << power);
+        return true;
+    }
+
+    // Plain number (A size of 0 is not typed, only "2^64")
+    memorySize = strtoull(text.c_str(), &end, 0);
+    return (*end == '\0') && (end != text.c_str()) && (memorySize > 0);
+}
+
+#endif
\ No newline at end of file
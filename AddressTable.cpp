@@ -12,14 +12,28 @@
  * 
  *  Description: Address Table Class that simulates how the sequence of memory addresses 
  *          would look. Also displays a column to show if the main memory block is a 
- *          cache hit or miss.
+ *          cache hit or miss. Addresses and block numbers are 64-bit (Address).
+ *
+ *              Only the address, the read/write bit, and the hit bit are stored per
+ *          row (and the next use, for OPT). The main memory block, cache set, and
+ *          cache blocks columns are worked out from the address and the cache
+ *          geometry given to SetGeometry whenever they are asked for.
  *  
  ***************************************************************************************/
 
+#ifndef ADDRESSTABLE_CPP
+#define ADDRESSTABLE_CPP
+
+#include "BlockMap.h"
+#include "OptimalPolicy.h"
+#include "TraceRecord.h"
+#include "ResultWriter.cpp"
+#include "Address.h"
 #include <iostream>
 #include <string>
 #include <vector>
 #include <math.h>
+#include <algorithm>
 using namespace std;
 
 /****************************************************************************************
@@ -34,17 +48,21 @@ class AddressTable {
 
         // User Functions to Populate Table
         void SetSize(int s);
-        void AddRow(string line);
-        void CalculateMMBlock(int blockSize);
-        void CalculateCMSet(int cacheSize, int blockSize, int mappingAssociation);
-        void CalculateCMBlock(int mappingAssociation);
+        void AddRow(bool write, Address address);
+        void SetGeometry(int cacheSize, int blockSize, int mappingAssociation);
+        void CalculateNextUse(int blockSize);
 
         // Getter Functions
         int GetSize();
-        int GetMMAddress(int index);
+        Address GetMMAddress(int index);
         bool GetIsWrite(int index);
-        int GetMMBlock(int index);
+        Address GetMMBlock(int index);
+        int GetCMSet(int index);
         int GetFirstCMBlock(int index);
+        bool GetIsHit(int index);
+        int GetNextUse(int index);
+        TraceRecord GetRecord(int index);
+        void GetChunk(int firstRow, int maxRows, vector<TraceRecord> &chunk);
 
         // Setter Function(s)
         void SetHit(int index);
@@ -53,22 +71,21 @@ class AddressTable {
         void CalculateActualHitRate();
 
         // Print Table
-        void Print();
+        void Print(ResultWriter &writer);
 
     private:
         // Variables Populated by Text file
         int size;
         vector<bool> isWrite;
-        vector<int> mmAddress;
+        vector<Address> mmAddress;
 
         // Variables Calculated & Set by Program
-        vector<string> binaryTag;
-        vector<int> mmBlock;
-        vector<int> cmSet;
-        vector<vector<int>> cmBlock;        // 2D Vector 
         vector<bool> isHit;
+        vector<int> nextUse;                // Only calculated for OPT replacement
 
-        // Variables used for Cache Memory Table
+        // Variables used for Cache Memory Table (Derived columns)
+        int blockSize;
+        int mappingAssociation;
         int cacheLines;
         int cacheSets;
 };
@@ -78,6 +95,10 @@ class AddressTable {
  *************************************************************************************/
 AddressTable::AddressTable() {
     size = 0;
+    blockSize = 0;
+    mappingAssociation = 1;
+    cacheLines = 0;
+    cacheSets = 1;
 }
 
 /**************************************************************************************
@@ -87,11 +108,8 @@ AddressTable::~AddressTable() {
     // Clear Vectors to free up memory space for next simulation
     isWrite.clear();
     mmAddress.clear();
-    binaryTag.clear();
-    mmBlock.clear();
-    cmSet.clear();
-    cmBlock.clear();
     isHit.clear();
+    nextUse.clear();
 }
 
 /**************************************************************************************
@@ -99,119 +117,89 @@ AddressTable::~AddressTable() {
  * Input Parameters:    int - represents the total number of memory accesses 
  *                      (reads/writes) to occur
  * Return Value:        void
- * Purpose:             Sets the size variable to equal the integer s
+ * Purpose:             Sets the size variable to equal the integer s. Reserves room
+ *                      for s rows so adding rows does not reallocate the vectors.
  *************************************************************************************/
 void AddressTable::SetSize(int s) {
     // Set address Table size equal to integer s
     size = s;
+
+    // Reserve room for every row
+    isWrite.reserve(size);
+    mmAddress.reserve(size);
+    isHit.reserve(size);
 }
 
 /**************************************************************************************
  * Function Name:       AddRow
- * Input Parameters:    string - represents the line to be parsed
+ * Input Parameters:    bool write - represents whether the operation is a write
+ *                      Address address - represents the main memory address
  * Return Value:        void
- * Purpose:             Parses a string and adds an element to the isWrite and 
- *                      mmAddress vectors. 
+ * Purpose:             Adds an already parsed row to the isWrite and mmAddress 
+ *                      vectors. Used by the Trace Reader, which parses the file
+ *                      in place without creating strings.
  *************************************************************************************/
-void AddressTable::AddRow(string line) {
-    // Declare temporary variables for parsing string
-    char operation;
-    string tempAddress;
-
-    // Read First char to determine if operation is read or write
-    operation = line.at(0);
-
-    // If operation is W, set isWrite to 1
-    if (operation == 'W') {
-        isWrite.push_back(1);
-    }
-    // If operation is R, set isWrite to 0
-    else {
-        isWrite.push_back(0);
-    }
-
-    // Get address as a substring starting at position 2
-    tempAddress = line.substr(2);   
-
-    // Convert string to int and add main memory address to vector
-    mmAddress.push_back(stoi(tempAddress));
+void AddressTable::AddRow(bool write, Address address) {
+    // Add operation and main memory address to vectors
+    isWrite.push_back(write);
+    mmAddress.push_back(address);
 
     // Add a Hit/Miss Variable (Initialized to 0/Miss)
     isHit.push_back(0);
 }
 
-/*************************************************************************************
- * Function Name:       CalculateMMBlock
- * Input Parameters:    int - represents size of the blocksize
- * Return Value:        void
- * Purpose:             Calculates the MMBlock Number for each main memory address 
- *                      that is read or written. Populates the mmBlock vector.
- ************************************************************************************/
-void AddressTable::CalculateMMBlock(int blockSize) {
-    // Calculate and Populate mmBlock Vector
-    for(int i=0; i < size; i++) {
-        // Check if blockSize 0. (Can't divide by 0)
-        if (blockSize == 0) {
-            mmBlock.push_back(0);
-        }
-        else {
-            // Main Memory Block Number = Main Memory Address / Block Size
-            mmBlock.push_back(mmAddress.at(i) / blockSize);
-        }
-    }
-}
-
 /**************************************************************************************
- * Function Name:       CalculateCMSet
+ * Function Name:       SetGeometry
  * Input Parameters:    int cacheSize - represents the size of the cache in bytes
  *                      int blockSize - represents the block size in bytes
- *                      int mappingAssociation - represents the chosen mapping 
- *                      Associaiton (1 = FIFO, 0 = LRU)
+ *                      int mappingAssociation - represents the N of N-way mapping
  * Return Value:        void
- * Purpose:             Calculates the Cache Memory Set Number for each main memory 
- *                      address that is read or written to. Populates the cmSet vector.
+ * Purpose:             Keeps the cache geometry the main memory block, cache memory
+ *                      set, and cache memory block columns are derived from. Nothing
+ *                      is stored per row, so this costs the same for any trace.
  *************************************************************************************/
-void AddressTable::CalculateCMSet(int cacheSize, int blockSize, int mappingAssociation) {
+void AddressTable::SetGeometry(int cacheSize, int blockSize, int mappingAssociation) {
+    // Set Variables
+    this->blockSize = blockSize;
+    this->mappingAssociation = mappingAssociation;
+
     // Calculate Number of Cache Lines
-    // Cache Lines = Cache Size / Block Size
-    cacheLines = cacheSize/blockSize;
+    // Cache Lines = Cache Size / Block Size (Check if blockSize 0. Can't divide by 0)
+    cacheLines = (blockSize == 0) ? 0 : cacheSize / blockSize;
 
     // Calculate Total Number of Cache Sets according to N-Way Mapping Associativity
-    cacheSets = cacheLines/mappingAssociation;
-    
-    // Calculate Cache Memory Set Number
-    for(int i=0; i < size; i++) {
-        // Cache Memory Set Number = MMBlock % cacheSets
-        cmSet.push_back(mmBlock.at(i) % cacheSets);
-    }
+    // (At least one, so GetCMSet never divides by 0)
+    cacheSets = max(cacheLines / mappingAssociation, 1);
 }
 
 /**************************************************************************************
- * Function Name:       CalculateCMBlock
- * Input Parameters:    int mappingAssociation - represents the chosen mapping 
- *                      Association (1 = FIFO, 0 = LRU)
+ * Function Name:       CalculateNextUse
+ * Input Parameters:    int blockSize - represents the block size in bytes
  * Return Value:        void
- * Purpose:             Calculates the Cache Memory Block Numbers for each main memory 
- *                      address that is read or written to. Populates the cmBlock 
- *                      vector.
+ * Purpose:             Calculates, for each row, the row of the next access to the
+ *                      same main memory block (NO_NEXT_USE if the block is never 
+ *                      accessed again). Populates the nextUse vector in one backward
+ *                      pass, remembering the latest row seen of each block in a 
+ *                      BlockMap. Needed by OPT replacement.
  *************************************************************************************/
-void AddressTable::CalculateCMBlock(int mappingAssociation) {
-    // Declare temp vector to hold cache memory blocks
-    vector<int> temp;
-
-    // Populate Cache Memory Block vectors
-    for(int i=0; i < size; i++) {
-        // Number of cmBlocks equals mappingAssociation
-        // Ex: 2-Way association means 2 memory blocks in vector
-        for(int j=0; j < mappingAssociation; j++){
-            temp.push_back((cmSet.at(i) * mappingAssociation) + j);
+void AddressTable::CalculateNextUse(int blockSize) {
+    // Declare map from block to the nearest later row that accesses it
+    BlockMap laterRow;
+
+    // Walk the table from the last row to the first
+    nextUse.assign(size, NO_NEXT_USE);
+    for(int i = size - 1; i >= 0; i--) {
+        // Main Memory Block Number = Main Memory Address / Block Size
+        long long block = (long long)(mmAddress.at(i) / blockSize);
+
+        // Next use is the later row found so far, if any
+        int row = laterRow.Find(block);
+        if(row >= 0) {
+            nextUse.at(i) = row;
         }
 
-        // Add temp vector of integers to cmBlock vector
-        cmBlock.push_back(temp);
-
-        // Erase items in temp
-        temp.clear();
+        // This row is now the nearest later row for the block
+        laterRow.Insert(block, i);
     }
 }
 
@@ -232,11 +220,11 @@ int AddressTable::GetSize() {
 /**************************************************************************************
  * Function Name:       GetMMAddress
  * Input Parameters:    int - represents the index/row to be accessed
- * Return Value:        int - represents the main memory address
+ * Return Value:        Address - represents the main memory address
  * Purpose:             Returns the main memory address from a given row of the Address
  *                      Table
  *************************************************************************************/
-int AddressTable::GetMMAddress(int index) {
+Address AddressTable::GetMMAddress(int index) {
     // Return main memory address from index of table
     return mmAddress.at(index);
 }
@@ -256,29 +244,109 @@ bool AddressTable::GetIsWrite(int index) {
 /***************************************************************************************
  * Function Name:       GetMMBlock
  * Input Parameters:    int - represents the index/row to be accessed
- * Return Value:        int - represents the main memory block number
- * Purpose:             Returns the main memory block number from a given row in the 
+ * Return Value:        Address - represents the main memory block number
+ * Purpose:             Returns the main memory block number of a given row in the 
  *                      Address Table
  **************************************************************************************/
-int AddressTable::GetMMBlock(int index) {
-    // Return the Main Memory block Number from index of mmBlock vector
-    return mmBlock.at(index);
+Address AddressTable::GetMMBlock(int index) {
+    // Check if blockSize 0. (Can't divide by 0)
+    if(blockSize == 0) {
+        return 0;
+    }
+
+    // Main Memory Block Number = Main Memory Address / Block Size
+    return mmAddress.at(index) / blockSize;
+}
+
+/***************************************************************************************
+ * Function Name:       GetCMSet
+ * Input Parameters:    int - represents the index/row to be accessed
+ * Return Value:        int - represents the cache memory set number
+ * Purpose:             Returns the cache memory set number of a given row in the 
+ *                      Address Table
+ **************************************************************************************/
+int AddressTable::GetCMSet(int index) {
+    // Cache Memory Set Number = MMBlock % cacheSets
+    return (int)(GetMMBlock(index) % cacheSets);
 }
 
 /**************************************************************************************
  * Function Name:       GetFirstCMBlock
  * Input Parameters:    int - represents the index/row to be accessed
- * Return Value:        int - represents the first item from the 2D vector, cache 
- *                      memory block
- * Purpose:             Returns the first item at the given index from the 2D vector
- *                      called cmBlock. Since the cache memory blocks are sequential
- *                      and there are as many blocks as mappingAssociation, just 
- *                      sending the first item in the vector will suffice rather than
- *                      sending a whole vector.
+ * Return Value:        int - represents the first cache memory block of the row's set
+ * Purpose:             Returns the first cache memory block the row can be placed in.
+ *                      Since the cache memory blocks of a set are sequential and
+ *                      there are as many blocks as mappingAssociation, the first
+ *                      block stands for all of them.
  **************************************************************************************/
 int AddressTable::GetFirstCMBlock(int index) {
-    // Return the first item from index of the 2D vector cmBlock
-    return cmBlock[index][0];
+    // Ex: 2-Way association means blocks (Set * 2) and (Set * 2) + 1
+    return GetCMSet(index) * mappingAssociation;
+}
+
+/**************************************************************************************
+ * Function Name:       GetIsHit
+ * Input Parameters:    int - represents the index of the Address Table
+ * Return Value:        bool - represents whether the access at index was a hit
+ * Purpose:             Returns the isHit value at index
+ *************************************************************************************/
+bool AddressTable::GetIsHit(int index) {
+    // Return isHit at index
+    return isHit.at(index);
+}
+
+/**************************************************************************************
+ * Function Name:       GetNextUse
+ * Input Parameters:    int - represents the index of the Address Table
+ * Return Value:        int - represents the row of the next access to the same block
+ * Purpose:             Returns the nextUse value at index, or NO_NEXT_USE if next
+ *                      uses were not calculated
+ *************************************************************************************/
+int AddressTable::GetNextUse(int index) {
+    // Next uses are only calculated for OPT replacement
+    if(nextUse.empty()) {
+        return NO_NEXT_USE;
+    }
+
+    // Return nextUse at index
+    return nextUse.at(index);
+}
+
+/**************************************************************************************
+ * Function Name:       GetRecord
+ * Input Parameters:    int - represents the index of the Address Table
+ * Return Value:        TraceRecord - represents the row's access and next use
+ * Purpose:             Returns the row as a record the Cache Engine can take in a
+ *                      chunk
+ *************************************************************************************/
+TraceRecord AddressTable::GetRecord(int index) {
+    // Copy the row's address, operation, and next use
+    TraceRecord record;
+    record.address = mmAddress[index];
+    record.isWrite = isWrite[index];
+    record.nextUse = nextUse.empty() ? NO_NEXT_USE : nextUse[index];
+    return record;
+}
+
+/**************************************************************************************
+ * Function Name:       GetChunk
+ * Input Parameters:    int firstRow - represents the first row of the chunk
+ *                      int maxRows - represents the most rows in the chunk
+ *                      vector<TraceRecord> &chunk - filled with the rows' records
+ * Return Value:        void
+ * Purpose:             Copies up to maxRows rows, starting at firstRow, into chunk.
+ *                      The chunk vector keeps its capacity, so reusing it does not
+ *                      allocate.
+ *************************************************************************************/
+void AddressTable::GetChunk(int firstRow, int maxRows, vector<TraceRecord> &chunk) {
+    // Empty the chunk but keep its memory
+    chunk.clear();
+
+    // Copy rows until the chunk is full or the table ends
+    int lastRow = min(firstRow + maxRows, (int)mmAddress.size());
+    for(int i = firstRow; i < lastRow; i++) {
+        chunk.push_back(GetRecord(i));
+    }
 }
 
 /**************************************************************************************
@@ -327,68 +395,17 @@ void AddressTable::CalculateActualHitRate() {
 
 /**************************************************************************************
  * Function Name:       Print
- * Input Parameters:    void
+ * Input Parameters:    ResultWriter& - represents the output the rows are written to
  * Return Value:        void
- * Purpose:             Prints the Address Table as the user would see it 
+ * Purpose:             Writes every row of the Address Table to the Result Writer, 
+ *                      which formats them as the user chose
  *************************************************************************************/
-void AddressTable::Print() {
-    // Print Column Headers
-    cout << endl << "main memory address" << "\t" << "mm blk #" << "\t" << "cm set #";
-    cout << "\t" << "cm blk #" << "\t" << "hit/miss" << endl;
-    cout << "----------------------------------------------------------------------";
-    cout << "--------------" << endl;
-
-    // Print Rows
+void AddressTable::Print(ResultWriter &writer) {
+    // Write Rows
     for(int i=0; i < size; i++) {
-        // Print Main Memory Address
-        cout << "\t" << mmAddress.at(i);
-
-        // Print Main Memory Block Number
-        cout << "\t\t" << mmBlock.at(i);
-
-        // Print Cache Memory Set Number
-        cout << "\t\t" << cmSet.at(i) << "\t\t";
-
-        // Print Cache Block Number
-
-        // Case 1: Direct Mapping
-        if(cmBlock[i].size() == 1) {
-            // Only 1 Cache memory block to print
-            cout << cmBlock[i][0];
-        }
-
-        // Case 2: 2-Way Associative Mapping
-        else if(cmBlock[i].size() == 2) {
-            // Print the 2 cache memory blocks as "# OR #"
-            cout << cmBlock[i][0] << " or " << cmBlock[i][1];
-        }
-
-        // Case 3: N-Way Associative Mapping
-        else {
-            // Print the range of cache memory blocks as "# to #"
-            cout << cmBlock[i][0] << " to " << (cmBlock[i][0] + (cmBlock[i].size()) - 1);
-        }
-
-        // Indentation/Formatting Print tabs
-        if((cmBlock[i][0] < 10) || (cmBlock[i].size() == 1)) {
-            cout << "\t\t";
-        }
-        else {
-            cout << "\t";
-        }
-
-        // Print Hit or Miss
-        
-        // Case 1: Check if Hit
-        if(isHit.at(i)) {
-            // Print Hit
-            cout << "hit" << endl;
-        }
-        
-        // Case 2: Not a Hit
-        else {
-            // Print Miss
-            cout << "miss" << endl;
-        }
+        writer.WriteRow(i, mmAddress.at(i), isWrite.at(i), GetMMBlock(i), GetCMSet(i), 
+                GetFirstCMBlock(i), mappingAssociation, isHit.at(i));
     }
-}
\ No newline at end of file
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,560 @@
+/****************************************************************************************
+ *  Memory Simulator: "BatchRunner.cpp"
+ *
+ *  Author:     Hannah Perkins
+ *  CWID:       11472559
+ *  Assignment: Lab #7
+ *
+ *  Date:       17 October 2026
+ *  Course:     ECE 487
+ *
+ *  Function:   Runs cache simulations from command-line flags and batch files
+ *
+ *  Description: Batch Runner Class used when the program is started with arguments.
+ *          It never reads from stdin. The flags describe one configuration:
+ *
+ *              --memory <bytes>    main memory size, or 2^N    (default 65536)
+ *              --cache <bytes>     cache size                  (default 1024)
+ *              --block <bytes>     block size                  (default 16)
+ *              --assoc <n>         n-way set-associativity     (default 1)
+ *              --policy <letter>   L, F, P, S, B, R, or U      (default L)
+ *              --write <letter>    B = write-back, T = write-through   (default B)
+ *              --alloc <letter>    A = write-allocate, N = no-write-allocate (default A)
+ *              --buffer <n>        write buffer entries        (default 0)
+ *              --trace <file>      trace file (text or binary), or a generator
+ *                                  spec such as gen:uniform,footprint=65536
+ *
+ *          With "--batch <file>", every non-empty line of the file not starting
+ *          with '#' is one more configuration, written with the same flags. Flags on
+ *          the command line are the defaults for every line. Without --batch, the
+ *          command line itself is the only configuration.
+ *
+ *          Configurations are run back to back in one process, each one streamed
+ *          through a Cache Engine and a Miss Classifier like the streaming mode.
+ *          One CSV row per configuration is written to "--output <file>" (or to
+ *          stdout), after a header row. Problems are written to stderr; a bad
+ *          configuration is skipped and makes the exit code 1. OPT is not allowed,
+ *          since it needs the whole trace before the first access.
+ *
+ ***************************************************************************************/
+
+#ifndef BATCHRUNNER_CPP
+#define BATCHRUNNER_CPP
+
+#include "CacheEngine.h"
+#include "MissClassifier.cpp"
+#include "TraceReader.cpp"
+#include "ReplacementPolicy.h"
+#include "Address.h"
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <stdlib.h>
+#include <ctype.h>
+using namespace std;
+
+/****************************************************************************************
+ * Struct Name:         BatchConfig
+ * Purpose:             Holds the settings of one batch run
+ ***************************************************************************************/
+struct BatchConfig {
+    Address mainMemorySize;             // 0 = 2^64
+    int cacheSize;
+    int blockSize;
+    int mappingAssociation;
+    int replacementPolicy;
+    bool writeBack;
+    bool writeAllocate;
+    int writeBufferEntries;
+    string fileName;
+};
+
+/****************************************************************************************
+ * Class Name:          BatchRunner
+ * Purpose:             Parses command-line flags and batch files, and runs every
+ *                      configuration without user input
+ ***************************************************************************************/
+class BatchRunner {
+    public:
+        BatchRunner();                              // Constructor
+
+        // User Functions
+        int Run(int argc, char* argv[]);
+        void PrintUsage();
+
+    private:
+        // Variables Set by User
+        BatchConfig defaults;
+        string batchFileName;
+        string outputFileName;
+
+        // Variables Calculated and Set by Program
+        vector<BatchConfig> configs;
+        bool failed;
+
+        // Helper Functions
+        bool ParseFlags(vector<string> &tokens, BatchConfig &config, bool commandLine);
+        bool ParseNumber(string flag, string value, int &number);
+        bool ParseChoice(string flag, string value, string letter, string name, 
+                string otherLetter, string otherName, bool &choice);
+        bool ReadBatchFile();
+        string CheckConfig(BatchConfig &config);
+        void RunConfig(BatchConfig &config, ostream &output);
+        void PrintHeader(ostream &output);
+};
+
+/****************************************************************************************
+ * Constructor
+ ***************************************************************************************/
+BatchRunner::BatchRunner() {
+    // Default Configuration
+    defaults.mainMemorySize = 65536;
+    defaults.cacheSize = 1024;
+    defaults.blockSize = 16;
+    defaults.mappingAssociation = 1;
+    defaults.replacementPolicy = LRU_POLICY;
+    defaults.writeBack = true;
+    defaults.writeAllocate = true;
+    defaults.writeBufferEntries = 0;
+    defaults.fileName = "";
+
+    // Nothing run yet
+    failed = false;
+}
+
+/****************************************************************************************
+ * Function Name:       Run
+ * Input Parameters:    int argc - represents the number of command-line arguments
+ *                      char* argv[] - represents the command-line arguments
+ * Return Value:        int - represents the exit code (0 = every configuration ran,
+ *                      1 = a configuration was skipped, 2 = bad arguments)
+ * Purpose:             Reads the flags and batch file, then runs every configuration
+ *                      and writes the CSV summary
+ ***************************************************************************************/
+int BatchRunner::Run(int argc, char* argv[]) {
+    // Command Line Tokens (argv[0] is the program name)
+    vector<string> tokens;
+    for(int i=1; i < argc; i++) {
+        tokens.push_back(argv[i]);
+    }
+
+    // Print usage if asked
+    for(int i=0; i < (int)tokens.size(); i++) {
+        if((tokens[i] == "--help") || (tokens[i] == "-h")) {
+            PrintUsage();
+            return 0;
+        }
+    }
+
+    // Command Line sets the defaults
+    if(!ParseFlags(tokens, defaults, true)) {
+        cerr << "Run with --help for the list of flags" << endl;
+        return 2;
+    }
+
+    // Batch File lines, or the command line alone
+    if(batchFileName.length() > 0) {
+        if(!ReadBatchFile()) {
+            return 2;
+        }
+    }
+    else {
+        configs.push_back(defaults);
+    }
+
+    // Open Output (stdout unless a file was given)
+    ofstream outputFile;
+    if(outputFileName.length() > 0) {
+        outputFile.open(outputFileName);
+        if(!outputFile.is_open()) {
+            cerr << "Unable to open output file: " << outputFileName << endl;
+            return 2;
+        }
+    }
+    ostream &output = (outputFileName.length() > 0) ? outputFile : cout;
+
+    // Run every Configuration back to back
+    PrintHeader(output);
+    for(int i=0; i < (int)configs.size(); i++) {
+        RunConfig(configs[i], output);
+    }
+
+    return failed ? 1 : 0;
+}
+
+/****************************************************************************************
+ * Function Name:       PrintUsage
+ * Input Parameters:    void
+ * Return Value:        void
+ * Purpose:             Prints the flags the batch runner accepts
+ ***************************************************************************************/
+void BatchRunner::PrintUsage() {
+    // Print Flags
+    cout << "Usage: memorysim [flags]       (no flags = interactive prompts)" << endl;
+    cout << "  --memory <bytes>    main memory size, or 2^N (default 65536)" << endl;
+    cout << "  --cache <bytes>     cache size (default 1024)" << endl;
+    cout << "  --block <bytes>     block size (default 16)" << endl;
+    cout << "  --assoc <n>         n-way set-associativity (default 1)" << endl;
+    cout << "  --policy <letter>   L = LRU, F = FIFO, P = tree PLRU, S = SRRIP, ";
+    cout << "B = BRRIP, R = random, U = LFU (default L)," << endl;
+    cout << "                      or the policy's name (LRU, PLRU, Random, ...)" << endl;
+    cout << "  --write <letter>    B = write-back, T = write-through (default B)" << endl;
+    cout << "  --alloc <letter>    A = write-allocate, N = no-write-allocate (default A)" << endl;
+    cout << "                      (--write and --alloc also take the full name)" << endl;
+    cout << "  --buffer <n>        write buffer entries, 0 = none (default 0)" << endl;
+    cout << "  --trace <file>      trace file (text or binary), or a generator spec" << endl;
+    cout << "                      gen:<pattern>[,key=value...] with pattern sequential," << endl;
+    cout << "                      strided, uniform, zipf, chase, or mixed and keys" << endl;
+    cout << "                      accesses, footprint, stride, alpha, writes, seed" << endl;
+    cout << "  --batch <file>      one configuration of the flags above per line" << endl;
+    cout << "  --output <file>     CSV summary file (default stdout)" << endl;
+    cout << "  --help              print this message" << endl;
+}
+
+/****************************************************************************************
+ * Function Name:       ParseFlags
+ * Input Parameters:    vector<string> &tokens - represents "--flag value" pairs
+ *                      BatchConfig &config - represents the configuration to change
+ *                      bool commandLine - represents whether --batch and --output
+ *                      are allowed (command line only)
+ * Return Value:        bool - represents whether every flag was understood
+ * Purpose:             Applies each flag to the configuration. A value can follow
+ *                      the flag or be joined to it with '=' ("--cache=1024").
+ ***************************************************************************************/
+bool BatchRunner::ParseFlags(vector<string> &tokens, BatchConfig &config, bool commandLine) {
+    // Read Flag by Flag
+    for(int i=0; i < (int)tokens.size(); i++) {
+        // Split "--flag=value", otherwise the value is the next token
+        string flag = tokens[i];
+        string value;
+        size_t equals = flag.find('=');
+        if(equals != string::npos) {
+            value = flag.substr(equals + 1);
+            flag = flag.substr(0, equals);
+        }
+        else if((i + 1) < (int)tokens.size()) {
+            i++;
+            value = tokens[i];
+        }
+
+        // Every flag needs a value
+        if(value.length() == 0) {
+            cerr << "Missing value for " << flag << endl;
+            return false;
+        }
+
+        // Apply Flag
+        if(flag == "--memory") {
+            if(!ParseMemorySize(value, config.mainMemorySize)) {
+                cerr << "Bad size for " << flag << ": " << value << endl;
+                return false;
+            }
+        }
+        else if(flag == "--cache") {
+            if(!ParseNumber(flag, value, config.cacheSize)) return false;
+        }
+        else if(flag == "--block") {
+            if(!ParseNumber(flag, value, config.blockSize)) return false;
+        }
+        else if(flag == "--assoc") {
+            if(!ParseNumber(flag, value, config.mappingAssociation)) return false;
+        }
+        else if(flag == "--buffer") {
+            if(!ParseNumber(flag, value, config.writeBufferEntries)) return false;
+        }
+        else if(flag == "--policy") {
+            config.replacementPolicy = ParsePolicyName(value);
+            if(config.replacementPolicy < 0) {
+                cerr << "Bad value for " << flag << ": " << value << endl;
+                return false;
+            }
+        }
+        else if(flag == "--write") {
+            if(!ParseChoice(flag, value, "B", "write-back", "T", "write-through",
+                    config.writeBack)) return false;
+        }
+        else if(flag == "--alloc") {
+            if(!ParseChoice(flag, value, "A", "write-allocate", "N", "no-write-allocate",
+                    config.writeAllocate)) return false;
+        }
+        else if(flag == "--trace") {
+            config.fileName = value;
+        }
+        else if(commandLine && (flag == "--batch")) {
+            batchFileName = value;
+        }
+        else if(commandLine && (flag == "--output")) {
+            outputFileName = value;
+        }
+        else {
+            cerr << "Unknown flag: " << flag << endl;
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/****************************************************************************************
+ * Function Name:       ParseNumber
+ * Input Parameters:    string flag - represents the flag, for the error message
+ *                      string value - represents the text of the number
+ *                      int &number - set to the number if it is valid
+ * Return Value:        bool - represents whether value is a whole number >= 0
+ * Purpose:             Converts a flag's value to an integer
+ ***************************************************************************************/
+bool BatchRunner::ParseNumber(string flag, string value, int &number) {
+    // Convert, requiring the whole value to be digits
+    char* end;
+    long parsed = strtol(value.c_str(), &end, 10);
+    if((value.length() == 0) || (*end != '\0') || (parsed < 0) || (parsed > 0x7FFFFFFF)) {
+        cerr << "Bad number for " << flag << ": " << value << endl;
+        return false;
+    }
+
+    number = (int)parsed;
+    return true;
+}
+
+/****************************************************************************************
+ * Function Name:       ParseChoice
+ * Input Parameters:    string flag - represents the flag, for the error message
+ *                      string value - represents the text of the choice
+ *                      string letter, name - represent the first choice (choice = 1)
+ *                      string otherLetter, otherName - represent the other choice
+ *                      (choice = 0)
+ *                      bool &choice - set to the choice if value names one
+ * Return Value:        bool - represents whether value is one of the two choices
+ * Purpose:             Converts a flag's value to one of two choices, given by its
+ *                      letter or its full name in any case ("T", "write-through")
+ ***************************************************************************************/
+bool BatchRunner::ParseChoice(string flag, string value, string letter, string name, 
+        string otherLetter, string otherName, bool &choice) {
+    // Compare in lower case (Letters are upper case)
+    string lower = value;
+    for(int i=0; i < (int)lower.length(); i++) {
+        lower[i] = tolower(lower[i]);
+    }
+
+    // Match Letter or Name
+    if((value.length() == 1) && (toupper(value[0]) == letter[0])) {
+        choice = true;
+    }
+    else if((value.length() == 1) && (toupper(value[0]) == otherLetter[0])) {
+        choice = false;
+    }
+    else if(lower == name) {
+        choice = true;
+    }
+    else if(lower == otherName) {
+        choice = false;
+    }
+    else {
+        cerr << "Bad value for " << flag << ": " << value << endl;
+        return false;
+    }
+
+    return true;
+}
+
+/****************************************************************************************
+ * Function Name:       ReadBatchFile
+ * Input Parameters:    void
+ * Return Value:        bool - represents whether the file was opened (1) or not (0)
+ * Purpose:             Adds one configuration per line of the batch file, starting
+ *                      from the command line's defaults. Skips empty lines, lines
+ *                      starting with '#', and lines with bad flags.
+ ***************************************************************************************/
+bool BatchRunner::ReadBatchFile() {
+    // Temporary Variables for each Line
+    string line;
+    string token;
+    int lineNumber = 0;
+
+    // Open File
+    ifstream file (batchFileName);
+    if(!file.is_open()) {
+        cerr << "Unable to open batch file: " << batchFileName << endl;
+        return false;
+    }
+
+    // Read Line by Line of File
+    while(getline(file, line)) {
+        lineNumber++;
+
+        // Split Line into tokens
+        vector<string> tokens;
+        istringstream lineStream (line);
+        while(lineStream >> token) {
+            tokens.push_back(token);
+        }
+
+        // Skip empty lines and comments
+        if((tokens.size() == 0) || (tokens[0].at(0) == '#')) {
+            continue;
+        }
+
+        // Add Configuration
+        BatchConfig config = defaults;
+        if(ParseFlags(tokens, config, false)) {
+            configs.push_back(config);
+        }
+        else {
+            cerr << "Skipping line " << lineNumber << " of " << batchFileName << endl;
+            failed = true;
+        }
+    }
+
+    return true;
+}
+
+/****************************************************************************************
+ * Function Name:       CheckConfig
+ * Input Parameters:    BatchConfig& - represents the configuration to check
+ * Return Value:        string - represents the problem, or "" if it can be run
+ * Purpose:             Checks the settings the interactive prompts assume are valid:
+ *                      sizes are powers of two and the cache fits in main memory
+ *                      (Cache geometry is checked by CacheEngine::CheckGeometry)
+ ***************************************************************************************/
+string BatchRunner::CheckConfig(BatchConfig &config) {
+    // Main memory size must be a power of two (A size of 0 stands for 2^64)
+    if((config.mainMemorySize & (config.mainMemorySize - 1)) != 0) {
+        return "sizes and associativity must be powers of two";
+    }
+
+    // Cache must be a geometry the Cache Engine can simulate
+    string problem = CacheEngine::CheckGeometry(config.cacheSize, config.blockSize,
+            config.mappingAssociation);
+    if(problem.length() != 0) {
+        return problem;
+    }
+
+    // Cache must fit in main memory
+    if((config.mainMemorySize != 0) && ((Address)config.cacheSize > config.mainMemorySize)) {
+        return "cache is larger than main memory";
+    }
+
+    // OPT must know every future access, which streaming never stores
+    if(config.replacementPolicy == OPT_POLICY) {
+        return "OPT needs the whole trace; use the address table mode";
+    }
+
+    // A trace is needed
+    if(config.fileName.length() == 0) {
+        return "no trace file (--trace)";
+    }
+
+    return "";
+}
+
+/****************************************************************************************
+ * Function Name:       RunConfig
+ * Input Parameters:    BatchConfig &config - represents the configuration to run
+ *                      ostream &output - represents where the CSV row is written
+ * Return Value:        void
+ * Purpose:             Streams the configuration's trace through a Cache Engine and
+ *                      a Miss Classifier and writes one CSV row of results
+ ***************************************************************************************/
+void BatchRunner::RunConfig(BatchConfig &config, ostream &output) {
+    // Chunk of decoded Memory Accesses and their results
+    vector<TraceRecord> chunk;
+    vector<AccessResult> results;
+    chunk.reserve(ACCESS_CHUNK_SIZE);
+
+    // Engine, Classifier, and Trace Reader for this run
+    CacheEngine engine;
+    MissClassifier missClassifier;
+    TraceReader reader;
+
+    // Skip configurations that cannot be run
+    string problem = CheckConfig(config);
+    if(problem.length() > 0) {
+        cerr << "Skipping configuration (" << problem << ")" << endl;
+        failed = true;
+        return;
+    }
+
+    // Start timer
+    chrono::steady_clock::time_point startTime = chrono::steady_clock::now();
+
+    // Open File
+    if(!reader.Open(config.fileName)) {
+        cerr << "Unable to open file: " << config.fileName << endl;
+        failed = true;
+        return;
+    }
+
+    // Set up the Cache
+    engine.SetEngine(config.mainMemorySize, config.cacheSize, config.blockSize,
+            config.mappingAssociation, config.replacementPolicy);
+    engine.SetWritePolicy(config.writeBack, config.writeAllocate, config.writeBufferEntries);
+    missClassifier.SetClassifier(config.cacheSize, config.blockSize);
+
+    // Simulate every Access, a chunk at a time
+    while(reader.NextChunk(chunk, ACCESS_CHUNK_SIZE) > 0) {
+        engine.AccessChunk(chunk, results);
+        for(int i=0; i < (int)chunk.size(); i++) {
+            missClassifier.Access(chunk[i].address, results[i].hit);
+        }
+    }
+    engine.FlushWriteBuffer();
+    reader.Close();
+
+    // Elapsed seconds
+    chrono::duration<double> elapsed = chrono::steady_clock::now() - startTime;
+
+    // Calculate hit rate (Guard against an empty trace)
+    double hitRate = 0;
+    if(engine.GetTotalAccesses() > 0) {
+        hitRate = (double)engine.GetTotalHits() / (double)engine.GetTotalAccesses();
+    }
+
+    // Write Configuration (Generator specs hold commas, so they are quoted)
+    if(config.fileName.find(',') != string::npos) {
+        output << "\"" << config.fileName << "\"";
+    }
+    else {
+        output << config.fileName;
+    }
+    output << ",";
+    if(config.mainMemorySize == 0) {
+        output << "2^64";
+    }
+    else {
+        output << config.mainMemorySize;
+    }
+    output << "," << config.cacheSize;
+    output << "," << config.blockSize << "," << config.mappingAssociation << ",";
+    output << GetPolicyName(config.replacementPolicy) << ",";
+    output << (config.writeBack ? "write-back" : "write-through") << ",";
+    output << (config.writeAllocate ? "write-allocate" : "no-write-allocate") << ",";
+    output << config.writeBufferEntries << ",";
+
+    // Write Results
+    output << engine.GetTotalAccesses() << "," << engine.GetTotalHits() << "," << hitRate;
+    output << "," << missClassifier.GetCompulsoryMisses() << ",";
+    output << missClassifier.GetCapacityMisses() << "," << missClassifier.GetConflictMisses();
+    output << "," << engine.GetBytesRead() << "," << engine.GetBytesWritten() << ",";
+    output << elapsed.count() << endl;
+}
+
+/****************************************************************************************
+ * Function Name:       PrintHeader
+ * Input Parameters:    ostream& - represents where the CSV header is written
+ * Return Value:        void
+ * Purpose:             Writes the names of the CSV columns
+ ***************************************************************************************/
+void BatchRunner::PrintHeader(ostream &output) {
+    // Configuration Columns
+    output << "trace,memory_size,cache_size,block_size,associativity,policy,";
+    output << "write_policy,write_miss_policy,write_buffer,";
+
+    // Result Columns
+    output << "accesses,hits,hit_rate,compulsory_misses,capacity_misses,conflict_misses,";
+    output << "bytes_read,bytes_written,seconds" << endl;
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,253 @@
+/****************************************************************************************
+ *  Memory Simulator: "BinaryTrace.cpp"
+ *
+ *  Author:     Hannah Perkins
+ *  CWID:       11472559
+ *  Assignment: Lab #7
+ *
+ *  Date:       17 October 2026
+ *  Course:     ECE 487
+ *
+ *  Function:   Defines and writes the compact binary trace format
+ *
+ *  Description: The binary trace format stores the same information as the text
+ *          format ("R <address>" / "W <address>" lines after a line holding the
+ *          number of accesses) in far fewer bytes:
+ *
+ *              Header (13 bytes):
+ *                  4 bytes     magic "CMST"
+ *                  1 byte      format version (1)
+ *                  8 bytes     number of records, little-endian
+ *
+ *              Each Record (1 to 10 bytes):
+ *                  varint      (zigzag(address - previous address) << 1) | isWrite
+ *                              (computed on 65 bits, so any 64-bit delta fits)
+ *
+ *          Addresses are delta-encoded against the previous record (the first
+ *          record is relative to address 0). The zigzag step maps small negative
+ *          deltas to small unsigned numbers, and the varint stores 7 bits per byte
+ *          with the high bit set on every byte except the last. Nearby accesses
+ *          therefore take a single byte.
+ *
+ *          The BinaryTraceWriter class below writes the format. The TraceReader
+ *          reads it.
+ *
+ ***************************************************************************************/
+
+#ifndef BINARYTRACE_CPP
+#define BINARYTRACE_CPP
+
+#include "Address.h"
+#include <stdio.h>
+#include <string>
+#include <vector>
+using namespace std;
+
+// Binary Trace Format Constants
+const char BINARY_TRACE_MAGIC[4] = {'C', 'M', 'S', 'T'};
+const unsigned char BINARY_TRACE_VERSION = 1;
+const int BINARY_TRACE_HEADER_SIZE = 13;
+
+/****************************************************************************************
+ * Class Name:          BinaryTraceWriter
+ * Purpose:             Writes memory accesses to a file in the binary trace format
+ ***************************************************************************************/
+class BinaryTraceWriter {
+    public:
+        BinaryTraceWriter();                        // Constructor
+        ~BinaryTraceWriter();                       // Destructor
+
+        // User Functions
+        bool Open(string fileName);
+        void Write(bool isWrite, Address address);
+        void Close();
+
+        // Getter Functions
+        long long GetRecords();
+        long long GetBytesWritten();
+
+    private:
+        // Output File
+        FILE* file;
+
+        // Output Buffer (Flushed to the file when full)
+        vector<unsigned char> buffer;
+
+        // Variables Updated while Writing
+        Address previousAddress;
+        long long records;
+        long long bytesWritten;
+
+        // Helper Functions
+        void WriteHeader();
+        void Flush();
+};
+
+/****************************************************************************************
+ * Constructor
+ ***************************************************************************************/
+BinaryTraceWriter::BinaryTraceWriter() {
+    // No file open yet
+    file = NULL;
+    previousAddress = 0;
+    records = 0;
+    bytesWritten = 0;
+}
+
+/****************************************************************************************
+ * Destructor
+ ***************************************************************************************/
+BinaryTraceWriter::~BinaryTraceWriter() {
+    // Finish the file if still open
+    Close();
+}
+
+/****************************************************************************************
+ * Function Name:       Open
+ * Input Parameters:    string - represents the name of the binary trace file
+ * Return Value:        bool - represents whether the file was opened (1) or not (0)
+ * Purpose:             Creates the binary trace file and writes a placeholder header.
+ *                      The header's record count is filled in by Close.
+ ***************************************************************************************/
+bool BinaryTraceWriter::Open(string fileName) {
+    // Close any previously opened file
+    Close();
+
+    // Open File
+    file = fopen(fileName.c_str(), "wb");
+    if(file == NULL) {
+        return false;
+    }
+
+    // Reset counters and reserve 1 MB of buffer
+    previousAddress = 0;
+    records = 0;
+    bytesWritten = 0;
+    buffer.clear();
+    buffer.reserve(1 << 20);
+
+    // Write Header with a record count of 0 for now
+    WriteHeader();
+
+    return true;
+}
+
+/****************************************************************************************
+ * Function Name:       Write
+ * Input Parameters:    bool isWrite - represents whether the access is a write
+ *                      Address address - represents the main memory address
+ * Return Value:        void
+ * Purpose:             Delta-, zigzag-, and varint-encodes one memory access into the
+ *                      output buffer
+ ***************************************************************************************/
+void BinaryTraceWriter::Write(bool isWrite, Address address) {
+    // Delta from previous address, then zigzag so small negatives stay small
+    long long delta = (long long)(address - previousAddress);
+    unsigned long long value = ((unsigned long long)delta << 1) ^ (unsigned long long)(delta >> 63);
+
+    // First byte holds the read/write bit and the lowest 6 bits of the value
+    unsigned char nextByte = (unsigned char)(((value & 0x3F) << 1) | (isWrite ? 1 : 0));
+    value = value >> 6;
+
+    // Remaining bytes hold 7 bits each, setting the high bit while more bytes follow
+    while(value != 0) {
+        buffer.push_back(nextByte | 0x80);
+        nextByte = (unsigned char)(value & 0x7F);
+        value = value >> 7;
+    }
+    buffer.push_back(nextByte);
+
+    // Update previous address and record count
+    previousAddress = address;
+    records++;
+
+    // Flush when the buffer is full
+    if(buffer.size() >= (1 << 20)) {
+        Flush();
+    }
+}
+
+/****************************************************************************************
+ * Function Name:       Close
+ * Input Parameters:    void
+ * Return Value:        void
+ * Purpose:             Flushes buffered records, rewrites the header with the final
+ *                      record count, and closes the file
+ ***************************************************************************************/
+void BinaryTraceWriter::Close() {
+    // Nothing to do if no file is open
+    if(file == NULL) {
+        return;
+    }
+
+    // Write remaining records
+    Flush();
+
+    // Rewrite header with the real record count (its bytes are already counted)
+    fseek(file, 0, SEEK_SET);
+    WriteHeader();
+    fwrite(buffer.data(), 1, buffer.size(), file);
+    buffer.clear();
+
+    // Close File
+    fclose(file);
+    file = NULL;
+}
+
+/****************************************************************************************
+ * Function Name:       GetRecords
+ * Input Parameters:    void
+ * Return Value:        long long - represents the number of records written
+ * Purpose:             Returns the number of memory accesses written so far
+ ***************************************************************************************/
+long long BinaryTraceWriter::GetRecords() {
+    // Return records
+    return records;
+}
+
+/****************************************************************************************
+ * Function Name:       GetBytesWritten
+ * Input Parameters:    void
+ * Return Value:        long long - represents the size of the file in bytes
+ * Purpose:             Returns the number of bytes in the file, including the header
+ *                      and any records still in the buffer
+ ***************************************************************************************/
+long long BinaryTraceWriter::GetBytesWritten() {
+    // Return bytes already in the file plus bytes still buffered
+    return bytesWritten + buffer.size();
+}
+
+/****************************************************************************************
+ * Function Name:       WriteHeader
+ * Input Parameters:    void
+ * Return Value:        void
+ * Purpose:             Adds the magic, version, and little-endian record count to the
+ *                      output buffer
+ ***************************************************************************************/
+void BinaryTraceWriter::WriteHeader() {
+    // Magic and Version
+    buffer.insert(buffer.end(), BINARY_TRACE_MAGIC, BINARY_TRACE_MAGIC + 4);
+    buffer.push_back(BINARY_TRACE_VERSION);
+
+    // Record Count, lowest byte first
+    for(int i=0; i < 8; i++) {
+        buffer.push_back((unsigned char)((unsigned long long)records >> (8 * i)));
+    }
+}
+
+/****************************************************************************************
+ * Function Name:       Flush
+ * Input Parameters:    void
+ * Return Value:        void
+ * Purpose:             Writes the output buffer to the file and empties the buffer
+ ***************************************************************************************/
+void BinaryTraceWriter::Flush() {
+    // Write buffer to file
+    fwrite(buffer.data(), 1, buffer.size(), file);
+
+    // Count bytes and empty buffer
+    bytesWritten += buffer.size();
+    buffer.clear();
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,94 @@
+/****************************************************************************************
+ *  Memory Simulator: "BlockMap.cpp"
+ *
+ *  Author:     Hannah Perkins
+ *  CWID:       11472559
+ *  Assignment: Lab #7
+ *
+ *  Date:       17 October 2026
+ *  Course:     ECE 487
+ *
+ *  Function:   Maps main memory block numbers to integer values
+ *
+ *  Description: Defines the BlockMap functions that are not called for every access:
+ *          creating, clearing, reserving room in, and growing the table. Find,
+ *          Insert, Erase, and Hash are inline in "BlockMap.h".
+ *
+ ***************************************************************************************/
+
+#include "BlockMap.h"
+using namespace std;
+
+/****************************************************************************************
+ * Constructor
+ ***************************************************************************************/
+BlockMap::BlockMap() {
+    // Start with an empty table of 1024 slots
+    Clear();
+}
+
+/****************************************************************************************
+ * Function Name:       Reserve
+ * Input Parameters:    long long - represents the most blocks the map will hold
+ * Return Value:        void
+ * Purpose:             Grows the table now so that it can hold that many blocks
+ *                      without growing (and allocating) while blocks are inserted
+ ***************************************************************************************/
+void BlockMap::Reserve(long long blocks) {
+    // Double until the blocks fill at most half of the slots
+    while((blocks * 2) > (long long)keys.size()) {
+        Grow();
+    }
+}
+
+/****************************************************************************************
+ * Function Name:       Clear
+ * Input Parameters:    void
+ * Return Value:        void
+ * Purpose:             Removes every block and shrinks the table back to 1024 slots
+ ***************************************************************************************/
+void BlockMap::Clear() {
+    // Reset table to 1024 empty slots
+    keys.assign(1024, EMPTY_SLOT);
+    values.assign(1024, 0);
+    mask = 1024 - 1;
+    size = 0;
+    hasLastBlock = false;
+    lastBlockValue = 0;
+}
+
+/****************************************************************************************
+ * Function Name:       GetSize
+ * Input Parameters:    void
+ * Return Value:        long long - represents the number of blocks in the map
+ * Purpose:             Returns the number of blocks stored
+ ***************************************************************************************/
+long long BlockMap::GetSize() {
+    // Return size
+    return size;
+}
+
+/****************************************************************************************
+ * Function Name:       Grow
+ * Input Parameters:    void
+ * Return Value:        void
+ * Purpose:             Doubles the number of slots and re-inserts every block
+ ***************************************************************************************/
+void BlockMap::Grow() {
+    // Move old slots aside and create a table twice as large
+    vector<unsigned long long> oldKeys;
+    vector<int> oldValues;
+    oldKeys.swap(keys);
+    oldValues.swap(values);
+    keys.assign(oldKeys.size() * 2, EMPTY_SLOT);
+    values.assign(oldKeys.size() * 2, 0);
+    mask = keys.size() - 1;
+    size = hasLastBlock ? 1 : 0;
+
+    // Re-insert every used slot
+    for(int i=0; i < (int)oldKeys.size(); i++) {
+        if(oldKeys[i] != EMPTY_SLOT) {
+            Insert((long long)(oldKeys[i] - 1), oldValues[i]);
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,194 @@
+/****************************************************************************************
+ *  Memory Simulator: "BlockMap.h"
+ *
+ *  Author:     Hannah Perkins
+ *  CWID:       11472559
+ *  Assignment: Lab #7
+ *
+ *  Date:       17 October 2026
+ *  Course:     ECE 487
+ *
+ *  Function:   Maps main memory block numbers to integer values
+ *
+ *  Description: Block Map Class that stores (block number, value) pairs in an
+ *          open-addressing hash table, the same way BlockSet stores block numbers
+ *          (linear probing, power-of-two size, at most half full). Unlike BlockSet,
+ *          blocks can also be removed. Removing a block shifts the blocks after it
+ *          back toward their home slots, so no "deleted" markers are left behind and
+ *          lookups stay short no matter how many blocks come and go. Keys are
+ *          stored as block + 1, and the block with every bit set sits beside the
+ *          table, as in BlockSet.
+ *
+ *              Find, Insert, Erase, and Hash are inline, since the Cache Engine
+ *          looks up every access of a fully associative cache in a BlockMap. A map
+ *          given room for all its blocks with Reserve never allocates again.
+ *
+ ***************************************************************************************/
+
+#ifndef BLOCKMAP_H
+#define BLOCKMAP_H
+
+#include "BlockSet.h"
+#include <vector>
+using namespace std;
+
+/****************************************************************************************
+ * Class Name:          BlockMap
+ * Purpose:             Hash map from main memory block numbers to integer values
+ ***************************************************************************************/
+class BlockMap {
+    public:
+        BlockMap();                                 // Constructor
+
+        // User Functions
+        int Find(long long block);
+        void Insert(long long block, int value);
+        void Erase(long long block);
+        void Reserve(long long blocks);
+        void Clear();
+
+        // Getter Functions
+        long long GetSize();
+
+    private:
+        // Hash Table Slots (Key is block + 1, EMPTY_SLOT when unused)
+        vector<unsigned long long> keys;
+        vector<int> values;
+        long long size;
+        int mask;
+
+        // Block with every bit set (Its key would be EMPTY_SLOT)
+        bool hasLastBlock;
+        int lastBlockValue;
+
+        // Helper Functions
+        int Hash(unsigned long long key);
+        void Grow();
+};
+
+/****************************************************************************************
+ * Function Name:       Find
+ * Input Parameters:    long long - represents the main memory block number
+ * Return Value:        int - represents the block's value, or -1 if the block is not
+ *                      in the map
+ * Purpose:             Looks up the value stored for the block
+ ***************************************************************************************/
+inline int BlockMap::Find(long long block) {
+    // Key of the block (The last block is kept beside the table)
+    unsigned long long key = (unsigned long long)block + 1;
+    if(key == EMPTY_SLOT) {
+        return hasLastBlock ? lastBlockValue : -1;
+    }
+
+    // Probe from the block's home slot until the block or an empty slot is found
+    int slot = Hash(key);
+    while(keys[slot] != EMPTY_SLOT) {
+        if(keys[slot] == key) {
+            return values[slot];
+        }
+        slot = (slot + 1) & mask;
+    }
+
+    return -1;
+}
+
+/****************************************************************************************
+ * Function Name:       Insert
+ * Input Parameters:    long long block - represents the main memory block number
+ *                      int value - represents the value to store for the block
+ * Return Value:        void
+ * Purpose:             Stores the value for the block, replacing any previous value
+ ***************************************************************************************/
+inline void BlockMap::Insert(long long block, int value) {
+    // Key of the block (The last block is kept beside the table)
+    unsigned long long key = (unsigned long long)block + 1;
+    if(key == EMPTY_SLOT) {
+        if(!hasLastBlock) {
+            hasLastBlock = true;
+            size++;
+        }
+        lastBlockValue = value;
+        return;
+    }
+
+    // Probe from the block's home slot until the block or an empty slot is found
+    int slot = Hash(key);
+    while(keys[slot] != EMPTY_SLOT) {
+        if(keys[slot] == key) {
+            values[slot] = value;
+            return;
+        }
+        slot = (slot + 1) & mask;
+    }
+
+    // Add block in the empty slot
+    keys[slot] = key;
+    values[slot] = value;
+    size++;
+
+    // Keep the table at most half full
+    if((size * 2) > (long long)keys.size()) {
+        Grow();
+    }
+}
+
+/****************************************************************************************
+ * Function Name:       Erase
+ * Input Parameters:    long long - represents the main memory block number
+ * Return Value:        void
+ * Purpose:             Removes the block from the map if it is there. Each block
+ *                      after the hole that could live in the hole (its home slot is
+ *                      not between the hole and its current slot) is moved into it.
+ ***************************************************************************************/
+inline void BlockMap::Erase(long long block) {
+    // Key of the block (The last block is kept beside the table)
+    unsigned long long key = (unsigned long long)block + 1;
+    if(key == EMPTY_SLOT) {
+        if(hasLastBlock) {
+            hasLastBlock = false;
+            size--;
+        }
+        return;
+    }
+
+    // Find the block's slot
+    int hole = Hash(key);
+    while(keys[hole] != key) {
+        if(keys[hole] == EMPTY_SLOT) {
+            return;
+        }
+        hole = (hole + 1) & mask;
+    }
+
+    // Shift following blocks back until an empty slot ends the run
+    int slot = (hole + 1) & mask;
+    while(keys[slot] != EMPTY_SLOT) {
+        // Distance from the block's home slot to its current slot and to the hole
+        int home = Hash(keys[slot]);
+        if(((slot - home) & mask) >= ((slot - hole) & mask)) {
+            keys[hole] = keys[slot];
+            values[hole] = values[slot];
+            hole = slot;
+        }
+        slot = (slot + 1) & mask;
+    }
+
+    // Empty the last hole
+    keys[hole] = EMPTY_SLOT;
+    size--;
+}
+
+/****************************************************************************************
+ * Function Name:       Hash
+ * Input Parameters:    unsigned long long - represents a block's key
+ * Return Value:        int - represents the block's home slot
+ * Purpose:             Mixes the key (Fibonacci hashing) so that blocks with
+ *                      regular strides spread over the whole table
+ ***************************************************************************************/
+inline int BlockMap::Hash(unsigned long long key) {
+    // Multiply by 2^64 / golden ratio and keep the high bits
+    unsigned long long mixed = key * 0x9E3779B97F4A7C15ULL;
+    return (int)(mixed >> 32) & mask;
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,64 @@
+/****************************************************************************************
+ *  Memory Simulator: "BlockSet.cpp"
+ *
+ *  Author:     Hannah Perkins
+ *  CWID:       11472559
+ *  Assignment: Lab #7
+ *
+ *  Date:       17 October 2026
+ *  Course:     ECE 487
+ *
+ *  Function:   Remembers which main memory blocks have been accessed
+ *
+ *  Description: Defines the BlockSet functions that are only called outside the
+ *          simulation loop: creating, clearing, merging, and growing the table.
+ *          Insert, Contains, and Hash are inline in "BlockSet.h".
+ *
+ ***************************************************************************************/
+
+#include "BlockSet.h"
+using namespace std;
+
+/****************************************************************************************
+ * Constructor
+ ***************************************************************************************/
+BlockSet::BlockSet() {
+    // Start with an empty table of 1024 slots
+    Clear();
+}
+
+/****************************************************************************************
+ * Function Name:       Clear
+ * Input Parameters:    void
+ * Return Value:        void
+ * Purpose:             Removes every block and shrinks the table back to 1024 slots
+ ***************************************************************************************/
+void BlockSet::Clear() {
+    // Reset table to 1024 empty slots
+    slots.assign(1024, EMPTY_SLOT);
+    mask = 1024 - 1;
+    size = 0;
+    hasLastBlock = false;
+}
+
+/****************************************************************************************
+ * Function Name:       Grow
+ * Input Parameters:    void
+ * Return Value:        void
+ * Purpose:             Doubles the number of slots and re-inserts every block
+ ***************************************************************************************/
+void BlockSet::Grow() {
+    // Move old slots aside and create a table twice as large
+    vector<unsigned long long> oldSlots;
+    oldSlots.swap(slots);
+    slots.assign(oldSlots.size() * 2, EMPTY_SLOT);
+    mask = slots.size() - 1;
+    size = hasLastBlock ? 1 : 0;
+
+    // Re-insert every used slot
+    for(int i=0; i < (int)oldSlots.size(); i++) {
+        if(oldSlots[i] != EMPTY_SLOT) {
+            Insert((long long)(oldSlots[i] - 1));
+        }
+    }
+}
\ No newline at end of file
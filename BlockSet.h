@@ -0,0 +1,156 @@
+/****************************************************************************************
+ *  Memory Simulator: "BlockSet.h"
+ *
+ *  Author:     Hannah Perkins
+ *  CWID:       11472559
+ *  Assignment: Lab #7
+ *
+ *  Date:       17 October 2026
+ *  Course:     ECE 487
+ *
+ *  Function:   Remembers which main memory blocks have been accessed
+ *
+ *  Description: Block Set Class that stores main memory block numbers in an
+ *          open-addressing hash table (linear probing, power-of-two size, at most
+ *          half full). Checking and adding a block is O(1) on average and never
+ *          allocates except when the table doubles, so it can count unique blocks
+ *          (compulsory misses) inside the simulation loop.
+ *
+ *              Every 64-bit block number is a real block (see "Address.h"), so no
+ *          block can stand for an empty slot. Slots hold block + 1 instead, with 0
+ *          marking an empty slot. The one block that would wrap to 0, the block
+ *          with every bit set, is kept beside the table (hasLastBlock).
+ *
+ ***************************************************************************************/
+
+#ifndef BLOCKSET_H
+#define BLOCKSET_H
+
+#include <vector>
+using namespace std;
+
+// Marks an unused slot of the hash table (Slots hold block + 1)
+const unsigned long long EMPTY_SLOT = 0;
+
+/****************************************************************************************
+ * Class Name:          BlockSet
+ * Purpose:             Hash set of main memory block numbers
+ ***************************************************************************************/
+class BlockSet {
+    public:
+        BlockSet();                                 // Constructor
+
+        // User Functions
+        bool Insert(long long block);
+        bool Contains(long long block);
+        void Clear();
+
+        // Getter Functions
+        long long GetSize();
+
+    private:
+        // Hash Table Slots (Block + 1, EMPTY_SLOT when unused)
+        vector<unsigned long long> slots;
+        long long size;
+        int mask;
+
+        // Block with every bit set (Its slot value would be EMPTY_SLOT)
+        bool hasLastBlock;
+
+        // Helper Functions
+        int Hash(unsigned long long key);
+        void Grow();
+};
+
+/****************************************************************************************
+ * Function Name:       Insert
+ * Input Parameters:    long long - represents the main memory block number
+ * Return Value:        bool - represents whether the block was new (1) or already in
+ *                      the set (0)
+ * Purpose:             Adds the block to the set if it is not already there
+ ***************************************************************************************/
+inline bool BlockSet::Insert(long long block) {
+    // Slot value of the block
+    unsigned long long key = (unsigned long long)block + 1;
+
+    // Last block is kept beside the table
+    if(key == EMPTY_SLOT) {
+        bool isNew = !hasLastBlock;
+        if(isNew) {
+            hasLastBlock = true;
+            size++;
+        }
+        return isNew;
+    }
+
+    // Probe from the block's home slot until the block or an empty slot is found
+    int slot = Hash(key);
+    while(slots[slot] != EMPTY_SLOT) {
+        if(slots[slot] == key) {
+            return false;
+        }
+        slot = (slot + 1) & mask;
+    }
+
+    // Add block in the empty slot
+    slots[slot] = key;
+    size++;
+
+    // Keep the table at most half full
+    if((size * 2) > (long long)slots.size()) {
+        Grow();
+    }
+
+    return true;
+}
+
+/****************************************************************************************
+ * Function Name:       Contains
+ * Input Parameters:    long long - represents the main memory block number
+ * Return Value:        bool - represents whether the block is in the set
+ * Purpose:             Checks if the block has been added to the set
+ ***************************************************************************************/
+inline bool BlockSet::Contains(long long block) {
+    // Slot value of the block (The last block is kept beside the table)
+    unsigned long long key = (unsigned long long)block + 1;
+    if(key == EMPTY_SLOT) {
+        return hasLastBlock;
+    }
+
+    // Probe from the block's home slot until the block or an empty slot is found
+    int slot = Hash(key);
+    while(slots[slot] != EMPTY_SLOT) {
+        if(slots[slot] == key) {
+            return true;
+        }
+        slot = (slot + 1) & mask;
+    }
+
+    return false;
+}
+
+/****************************************************************************************
+ * Function Name:       GetSize
+ * Input Parameters:    void
+ * Return Value:        long long - represents the number of blocks in the set
+ * Purpose:             Returns the number of unique blocks added
+ ***************************************************************************************/
+inline long long BlockSet::GetSize() {
+    // Return size
+    return size;
+}
+
+/****************************************************************************************
+ * Function Name:       Hash
+ * Input Parameters:    unsigned long long - represents a block's slot value
+ * Return Value:        int - represents the block's home slot
+ * Purpose:             Mixes the slot value (Fibonacci hashing) so that blocks
+ *                      with regular strides spread over the whole table
+ ***************************************************************************************/
+inline int BlockSet::Hash(unsigned long long key) {
+    // Multiply by 2^64 / golden ratio and keep the high bits
+    unsigned long long mixed = key * 0x9E3779B97F4A7C15ULL;
+    return (int)(mixed >> 32) & mask;
+}
+
+#endif
\ No newline at end of file
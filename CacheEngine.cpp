@@ -0,0 +1,433 @@
+/****************************************************************************************
+ *  Memory Simulator: "CacheEngine.cpp"
+ *
+ *  Author:     Hannah Perkins
+ *  CWID:       11472559
+ *  Assignment: Lab #7
+ *
+ *  Date:       17 October 2026
+ *  Course:     ECE 487
+ *
+ *  Function:   Performs memory accesses against the Cache Table
+ *
+ *  Description: Defines the CacheEngine functions that set up an engine, merge 
+ *          shards, print, and return counters, and AccessChunk, which picks the
+ *          policy's copy of the chunk loop. Everything called on each access is 
+ *          inline in "CacheEngine.h".
+ *
+ ***************************************************************************************/
+
+#include "CacheEngine.h"
+#include <math.h>
+using namespace std;
+
+/****************************************************************************************
+ * Constructor
+ ***************************************************************************************/
+CacheEngine::CacheEngine() {
+    // Initialize counters to 0
+    totalAccesses = 0;
+    totalHits = 0;
+
+    // Not fully associative until SetEngine says so
+    replacementPolicy = LRU_POLICY;
+    accessPolicy = LRU_POLICY;
+    fullyAssociative = false;
+    unusedLines = 0;
+
+    // Write-back, write-allocate, no write buffer unless asked for
+    writeBack = true;
+    writeAllocate = true;
+    bytesRead = 0;
+    bytesWritten = 0;
+}
+
+/****************************************************************************************
+ * Function Name:       SetEngine
+ * Input Parameters:    Address mainMemorySize - represents the size of main memory in bytes
+ *                      (0 = 2^64, see "Address.h")
+ *                      int cacheSize - represents the size of the cache in bytes
+ *                      int blockSize - represents the block size in bytes
+ *                      int mappingAssociation - represents the N of N-way mapping
+ *                      int replacementPolicy - represents the chosen replacement
+ *                      policy (see "ReplacementPolicy.h")
+ * Return Value:        void
+ * Purpose:             Calculates the offset, index, and tag bits for the given
+ *                      configuration and creates a default (empty) Cache Table.
+ ***************************************************************************************/
+void CacheEngine::SetEngine(Address mainMemorySize, int cacheSize, int blockSize,
+        int mappingAssociation, int replacementPolicy) {
+    // A whole cache is shard 0 of 1
+    SetShard(mainMemorySize, cacheSize, blockSize, mappingAssociation, replacementPolicy, 0, 1);
+}
+
+/****************************************************************************************
+ * Function Name:       SetShard
+ * Input Parameters:    Address mainMemorySize - represents the size of main memory in bytes
+ *                      (0 = 2^64, see "Address.h")
+ *                      int cacheSize - represents the size of the cache in bytes
+ *                      int blockSize - represents the block size in bytes
+ *                      int mappingAssociation - represents the N of N-way mapping
+ *                      int replacementPolicy - represents the chosen replacement
+ *                      policy (see "ReplacementPolicy.h")
+ *                      int shard - represents which shard this engine is
+ *                      int shards - represents the total number of shards
+ * Return Value:        void
+ * Purpose:             Same as SetEngine, but the Cache Table only holds the sets
+ *                      owned by this shard (set number % shards == shard). Accesses
+ *                      to other sets must not be given to this engine.
+ ***************************************************************************************/
+void CacheEngine::SetShard(Address mainMemorySize, int cacheSize, int blockSize,
+        int mappingAssociation, int replacementPolicy, int shard, int shards) {
+    // Store User Settings
+    this->blockSize = blockSize;
+    this->mappingAssociation = mappingAssociation;
+    this->replacementPolicy = replacementPolicy;
+    this->shard = shard;
+    this->shards = shards;
+
+    // Calculate Number of Cache Sets
+    cacheSets = (cacheSize / blockSize) / mappingAssociation;
+    powerOfTwoSets = (cacheSets & (cacheSets - 1)) == 0;
+
+    // Calculate how Address bits are divided among offset, index, and tag
+    // Tag = log2((mainMemorySize / cacheSize) * N), in floating point so a 2^64-byte
+    // main memory fits
+    offset = log2(blockSize);
+    index = log2((cacheSize / blockSize) / mappingAssociation);
+    tag = (int)floor(GetAddressBits(mainMemorySize) - log2(cacheSize) + log2(mappingAssociation));
+    tag = max(tag, 0);
+
+    // Calculate Number of Sets owned by this shard (shard, shard + shards, ...)
+    int ownedSets = (cacheSets - shard + shards - 1) / shards;
+
+    // Initialize CacheTable with owned cacheLines and Tag Size
+    cacheMemoryTable.SetCache(ownedSets * mappingAssociation, tag, mappingAssociation);
+
+    // A large fully associative cache finds lines through its tag index, and keeps
+    // LRU and FIFO order in a list rather than searching every line for a victim
+    int ownedLines = ownedSets * mappingAssociation;
+    fullyAssociative = (ownedSets == 1) && (mappingAssociation >= FULLY_ASSOCIATIVE_LINES);
+    accessPolicy = replacementPolicy;
+    if(fullyAssociative && (replacementPolicy == LRU_POLICY)) {
+        accessPolicy = LRU_LIST_POLICY;
+    }
+    if(fullyAssociative && (replacementPolicy == FIFO_POLICY)) {
+        accessPolicy = FIFO_LIST_POLICY;
+    }
+
+    // Empty index with room for every line, so accesses never grow it
+    lineOfTag.Clear();
+    freeLines.clear();
+    unusedLines = 0;
+    if(fullyAssociative) {
+        lineOfTag.Reserve(ownedLines);
+        freeLines.reserve(ownedLines);
+    }
+
+    // Initialize the chosen Replacement Policy's state for every owned line
+    switch(accessPolicy) {
+        case FIFO_POLICY:   fifoPolicy.SetPolicy(ownedLines, mappingAssociation); break;
+        case OPT_POLICY:    optimalPolicy.SetPolicy(ownedLines, mappingAssociation); break;
+        case PLRU_POLICY:   plruPolicy.SetPolicy(ownedLines, mappingAssociation); break;
+        case SRRIP_POLICY:  srripPolicy.SetPolicy(ownedLines, mappingAssociation); break;
+        case BRRIP_POLICY:  brripPolicy.SetPolicy(ownedLines, mappingAssociation); break;
+        case RANDOM_POLICY: randomPolicy.SetPolicy(ownedLines, mappingAssociation); break;
+        case LFU_POLICY:    lfuPolicy.SetPolicy(ownedLines, mappingAssociation); break;
+        case LRU_LIST_POLICY:   lruListPolicy.SetPolicy(ownedLines, mappingAssociation); break;
+        case FIFO_LIST_POLICY:  fifoListPolicy.SetPolicy(ownedLines, mappingAssociation); break;
+        default:            lruPolicy.SetPolicy(ownedLines, mappingAssociation); break;
+    }
+
+    // Reset counters
+    totalAccesses = 0;
+    totalHits = 0;
+    SetCounters noCounts = { 0, 0, 0, 0 };
+    setCounters.assign(ownedSets, noCounts);
+    bytesRead = 0;
+    bytesWritten = 0;
+    writeBuffer.SetBuffer(writeBuffer.GetEntries(), blockSize);
+}
+
+/****************************************************************************************
+ * Function Name:       CheckGeometry
+ * Input Parameters:    int cacheSize - represents the size of the cache in bytes
+ *                      int blockSize - represents the block size in bytes
+ *                      int mappingAssociation - represents the N of N-way mapping
+ * Return Value:        string - represents the problem, or "" if an engine can be set
+ *                      to this geometry
+ * Purpose:             Checks what SetEngine assumes: sizes and associativity are
+ *                      nonzero powers of two and the cache holds at least one set
+ ***************************************************************************************/
+string CacheEngine::CheckGeometry(int cacheSize, int blockSize, int mappingAssociation) {
+    // Every size must be a power of two (Address bits are split by log2)
+    int sizes[3] = { cacheSize, blockSize, mappingAssociation };
+    for(int i=0; i < 3; i++) {
+        if((sizes[i] <= 0) || ((sizes[i] & (sizes[i] - 1)) != 0)) {
+            return "sizes and associativity must be powers of two";
+        }
+    }
+
+    // Cache must hold at least one set (Block fits in the cache, N fits in its lines)
+    if(blockSize > cacheSize) {
+        return "block is larger than the cache";
+    }
+    if(mappingAssociation > (cacheSize / blockSize)) {
+        return "cache is smaller than one set";
+    }
+
+    return "";
+}
+
+/****************************************************************************************
+ * Function Name:       AccessChunk
+ * Input Parameters:    const vector<TraceRecord>& - represents decoded memory accesses
+ * Return Value:        void
+ * Purpose:             Performs every memory access of the chunk in order. The
+ *                      chosen policy is looked up once for the whole chunk.
+ ***************************************************************************************/
+void CacheEngine::AccessChunk(const vector<TraceRecord> &chunk) {
+    // Results are not kept
+    DispatchChunk(chunk, NULL);
+}
+
+/****************************************************************************************
+ * Function Name:       AccessChunk
+ * Input Parameters:    const vector<TraceRecord> &chunk - represents decoded memory
+ *                      accesses
+ *                      vector<AccessResult> &results - filled with the result of each
+ *                      access, in order
+ * Return Value:        void
+ * Purpose:             Same as AccessChunk, for loops that look at every access's hit
+ *                      or eviction. The results vector keeps its capacity, so reusing
+ *                      it does not allocate.
+ ***************************************************************************************/
+void CacheEngine::AccessChunk(const vector<TraceRecord> &chunk, vector<AccessResult> &results) {
+    // One result per access
+    results.resize(chunk.size());
+    DispatchChunk(chunk, results.data());
+}
+
+/****************************************************************************************
+ * Function Name:       DispatchChunk
+ * Input Parameters:    const vector<TraceRecord> &chunk - represents decoded memory
+ *                      accesses
+ *                      AccessResult* results - filled with each access's result, or
+ *                      NULL if the results are not needed
+ * Return Value:        void
+ * Purpose:             Runs the chosen replacement policy's copy of AccessChunkWith
+ ***************************************************************************************/
+void CacheEngine::DispatchChunk(const vector<TraceRecord> &chunk, AccessResult* results) {
+    // Pick the chosen policy's loop
+    switch(accessPolicy) {
+        case FIFO_POLICY:   AccessChunkWith(fifoPolicy, chunk, results); break;
+        case OPT_POLICY:    AccessChunkWith(optimalPolicy, chunk, results); break;
+        case PLRU_POLICY:   AccessChunkWith(plruPolicy, chunk, results); break;
+        case SRRIP_POLICY:  AccessChunkWith(srripPolicy, chunk, results); break;
+        case BRRIP_POLICY:  AccessChunkWith(brripPolicy, chunk, results); break;
+        case RANDOM_POLICY: AccessChunkWith(randomPolicy, chunk, results); break;
+        case LFU_POLICY:    AccessChunkWith(lfuPolicy, chunk, results); break;
+        case LRU_LIST_POLICY:   AccessChunkWith(lruListPolicy, chunk, results); break;
+        case FIFO_LIST_POLICY:  AccessChunkWith(fifoListPolicy, chunk, results); break;
+        default:            AccessChunkWith(lruPolicy, chunk, results); break;
+    }
+}
+
+/****************************************************************************************
+ * Function Name:       Invalidate
+ * Input Parameters:    Address - represents the main memory address
+ * Return Value:        AccessResult - evicted is set if the block was cached, and
+ *                      evictedDirty if the dropped copy was dirty
+ * Purpose:             Drops the address's block from the cache, as an inclusive 
+ *                      lower level does when it evicts the block (back-invalidation)
+ *                      or as an exclusive level does when the block moves up. The 
+ *                      empty line is refilled first on the set's next miss.
+ ***************************************************************************************/
+AccessResult CacheEngine::Invalidate(Address address) {
+    // Declare result, nothing dropped until found
+    AccessResult result;
+    result.hit = false;
+    result.evicted = false;
+    result.evictedDirty = false;
+    result.evictedAddress = address;
+
+    // Find the block's line
+    int line = FindLine(address);
+    if(line < 0) {
+        return result;
+    }
+
+    // Report the dropped copy
+    result.hit = true;
+    result.evicted = true;
+    result.evictedDirty = cacheMemoryTable.GetDirtyBit(line);
+
+    // Fully associative: unindex the block and free the line
+    if(fullyAssociative) {
+        lineOfTag.Erase((long long)cacheMemoryTable.GetTag(line));
+        freeLines.push_back(line);
+        push_heap(freeLines.begin(), freeLines.end(), greater<int>());
+    }
+
+    // Clear Valid and Dirty Bits
+    cacheMemoryTable.SetValidBit(line, 0);
+    cacheMemoryTable.SetDirtyBit(line, 0);
+
+    return result;
+}
+
+/****************************************************************************************
+ * Function Name:       MergeShard
+ * Input Parameters:    CacheEngine& - represents a finished shard of this cache
+ * Return Value:        void
+ * Purpose:             Copies every line of the shard's sets into the same lines of
+ *                      this engine's Cache Table and adds the shard's counters to
+ *                      this engine's counters.
+ ***************************************************************************************/
+void CacheEngine::MergeShard(CacheEngine &shardEngine) {
+    // Copy each owned set of the shard
+    for(int set = shardEngine.shard; set < cacheSets; set += shardEngine.shards) {
+        // First line of the set in the shard's table and in the full table
+        int shardLine = (set / shardEngine.shards) * mappingAssociation;
+        int fullLine = (set / shards) * mappingAssociation;
+
+        // Copy all lines of the set
+        for(int j=0; j < mappingAssociation; j++) {
+            cacheMemoryTable.CopyLine(fullLine + j, shardEngine.cacheMemoryTable, shardLine + j);
+        }
+
+        // Copy the set's counters
+        setCounters[set / shards] = shardEngine.setCounters[set / shardEngine.shards];
+    }
+
+    // Add shard's counters
+    totalAccesses += shardEngine.totalAccesses;
+    totalHits += shardEngine.totalHits;
+    bytesRead += shardEngine.bytesRead;
+    bytesWritten += shardEngine.bytesWritten;
+}
+
+/****************************************************************************************
+ * Function Name:       Print
+ * Input Parameters:    ostream& - represents the console or file to print to
+ * Return Value:        void
+ * Purpose:             Calls the Print function from the Cache Table structure to
+ *                      print the cache memory table as the user would see it
+ ***************************************************************************************/
+void CacheEngine::Print(ostream &output) {
+    // Call Cache Table Print Function
+    cacheMemoryTable.Print(output);
+}
+
+/****************************************************************************************
+ * Function Name:       SetWritePolicy
+ * Input Parameters:    bool writeBack - represents write-back (1) or write-through (0)
+ *                      bool writeAllocate - represents write-allocate (1) or 
+ *                      no-write-allocate (0)
+ *                      int writeBufferEntries - represents the number of blocks in
+ *                      the coalescing write buffer (0 = no buffer)
+ * Return Value:        void
+ * Purpose:             Sets how writes are handled. Call after SetEngine or SetShard.
+ *                      A write buffer serves the whole cache, so a sharded cache 
+ *                      should not use one.
+ ***************************************************************************************/
+void CacheEngine::SetWritePolicy(bool writeBack, bool writeAllocate, int writeBufferEntries) {
+    // Store User Settings
+    this->writeBack = writeBack;
+    this->writeAllocate = writeAllocate;
+
+    // Empty Write Buffer
+    writeBuffer.SetBuffer(writeBufferEntries, blockSize);
+}
+
+/****************************************************************************************
+ * Function Name:       FlushWriteBuffer
+ * Input Parameters:    void
+ * Return Value:        void
+ * Purpose:             Sends every write still in the write buffer to the next level,
+ *                      as at the end of a simulation
+ ***************************************************************************************/
+void CacheEngine::FlushWriteBuffer() {
+    // Count the drained bytes
+    bytesWritten += writeBuffer.Flush();
+}
+
+/****************************************************************************************
+ * Function Name:       GetCacheSets
+ * Input Parameters:    void
+ * Return Value:        int - represents the number of sets in the whole cache
+ * Purpose:             Returns the number of cache sets
+ ***************************************************************************************/
+int CacheEngine::GetCacheSets() {
+    // Return cacheSets
+    return cacheSets;
+}
+
+/****************************************************************************************
+ * Function Name:       GetTotalAccesses
+ * Input Parameters:    void
+ * Return Value:        long long - represents the number of accesses performed
+ * Purpose:             Returns the number of read and write operations performed
+ ***************************************************************************************/
+long long CacheEngine::GetTotalAccesses() {
+    // Return totalAccesses
+    return totalAccesses;
+}
+
+/****************************************************************************************
+ * Function Name:       GetTotalHits
+ * Input Parameters:    void
+ * Return Value:        long long - represents the number of cache hits
+ * Purpose:             Returns the number of accesses that were cache hits
+ ***************************************************************************************/
+long long CacheEngine::GetTotalHits() {
+    // Return totalHits
+    return totalHits;
+}
+
+/****************************************************************************************
+ * Function Name:       GetSetCounters
+ * Input Parameters:    int - represents the cache memory set number
+ * Return Value:        SetCounters - represents the set's accesses, hits, evictions,
+ *                      and dirty evictions
+ * Purpose:             Returns the counters of one set (The set must belong to this 
+ *                      engine; every set does unless the engine is a shard)
+ ***************************************************************************************/
+SetCounters CacheEngine::GetSetCounters(int set) {
+    // Owned sets are stored one after another
+    return setCounters[set / shards];
+}
+
+/****************************************************************************************
+ * Function Name:       GetBytesRead
+ * Input Parameters:    void
+ * Return Value:        long long - represents the bytes read from the next level
+ * Purpose:             Returns the traffic of every block brought in by a miss
+ ***************************************************************************************/
+long long CacheEngine::GetBytesRead() {
+    // Return bytesRead
+    return bytesRead;
+}
+
+/****************************************************************************************
+ * Function Name:       GetBytesWritten
+ * Input Parameters:    void
+ * Return Value:        long long - represents the bytes written to the next level
+ * Purpose:             Returns the traffic of writebacks and write-through writes 
+ *                      (after coalescing, if there is a write buffer)
+ ***************************************************************************************/
+long long CacheEngine::GetBytesWritten() {
+    // Return bytesWritten
+    return bytesWritten;
+}
+
+/****************************************************************************************
+ * Function Name:       GetCoalescedWrites
+ * Input Parameters:    void
+ * Return Value:        long long - represents the writes merged in the write buffer
+ * Purpose:             Returns how many writes to the next level cost no traffic
+ ***************************************************************************************/
+long long CacheEngine::GetCoalescedWrites() {
+    // Return Write Buffer's count
+    return writeBuffer.GetCoalescedWrites();
+}
\ No newline at end of file
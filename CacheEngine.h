@@ -0,0 +1,724 @@
+/****************************************************************************************
+ *  Memory Simulator: "CacheEngine.h"
+ *
+ *  Author:     Hannah Perkins
+ *  CWID:       11472559
+ *  Assignment: Lab #7
+ *
+ *  Date:       17 October 2026
+ *  Course:     ECE 487
+ *
+ *  Function:   Performs memory accesses against the Cache Table
+ *
+ *  Description: Cache Engine Class that owns the Cache Table and applies one memory
+ *          access at a time to it. The engine only keeps the cache state and the
+ *          aggregate hit counters, so it can be driven row by row from the Address
+ *          Table or directly from a trace file while it is being read.
+ *
+ *          An engine can also be set up as one shard of a cache. Shard k of T owns
+ *          the sets whose number % T equals k and stores only those sets, so T shard
+ *          engines can simulate one cache on T threads without sharing any state.
+ *          MergeShard copies a finished shard's sets back into the full cache.
+ *
+ *          The replacement policies are defined in "ReplacementPolicy.h". The
+ *          access itself is written once, as the AccessWith template over the policy
+ *          class, and compiled separately for each policy. AccessChunk picks the
+ *          policy's copy once per chunk of accesses, so the simulation loop never
+ *          checks the policy again; the simulator's loops all go through it, and
+ *          the overload that fills a result per access serves loops that need
+ *          hits and evictions. Access picks the copy once per access, for programs
+ *          that embed the engine. OPT (Belady's MIN) also needs the row of each 
+ *          access's next use, passed to Access or in each TraceRecord.
+ *
+ *          Access reports, besides hit or miss, the block it replaced and whether
+ *          that block was dirty, so a chain of engines can model a cache hierarchy.
+ *          For the same reason an engine can take a block without counting an
+ *          access (Fill), be checked for a block (Probe), and drop a block 
+ *          (Invalidate).
+ *
+ *          The write policy is write-back or write-through, and write-allocate or
+ *          no-write-allocate (SetWritePolicy). The engine counts the bytes it reads
+ *          from and writes to the next level: a block per fill, a block per dirty
+ *          line replaced, and a word per write sent straight through. Writes to the
+ *          next level can pass through a coalescing WriteBuffer.
+ *
+ *          Addresses are 64-bit (Address, see "Address.h"), so main memory can be
+ *          as large as 2^64 bytes. The block number is a shift of the address, and
+ *          the set number a mask of the block number when the number of sets is a
+ *          power of two, so 64-bit addresses cost no divisions. The Cache Table 
+ *          only keeps 64-bit tags when they do not fit in 32 bits.
+ *
+ *          A fully associative cache (one set) of FULLY_ASSOCIATIVE_LINES lines or
+ *          more is not probed line by line. A BlockMap from tag to line finds hits,
+ *          and the lowest empty line is kept aside (lines are filled in order, and
+ *          lines emptied by Invalidate go on a min-heap). LRU and FIFO keep their
+ *          order in a linked list of lines (LRUListPolicy, FIFOListPolicy). Hits,
+ *          fills, and replacements then take the same time however many lines the
+ *          cache has, which suits TLB and victim buffer models, and the results
+ *          are the same as probing every line.
+ *
+ *          This header is the interface of the cachesim library, which can be
+ *          linked into other programs to model a cache one access at a time:
+ *
+ *              CacheEngine cache;
+ *              cache.SetEngine(mainMemorySize, cacheSize, blockSize, n, LRU_POLICY);
+ *              AccessResult result = cache.Access(address, isWrite);
+ *
+ *          Access and everything it calls are inline in the headers. They do no I/O
+ *          and do not allocate memory. Compulsory misses, which need a set of every
+ *          block seen, are counted by the MissClassifier rather than the engine.
+ *          Set-up, counters, and printing are in "CacheEngine.cpp".
+ *
+ ***************************************************************************************/
+
+#ifndef CACHEENGINE_H
+#define CACHEENGINE_H
+
+#include "Address.h"
+#include "CacheTable.h"
+#include "BlockMap.h"
+#include "ReplacementPolicy.h"
+#include "TraceRecord.h"
+#include "WriteBuffer.h"
+#include <ostream>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <functional>
+using namespace std;
+
+// Fewest lines of a fully associative cache (one set) for which lines are found
+// through the tag index instead of by probing the set
+const int FULLY_ASSOCIATIVE_LINES = 8;
+
+// Accesses per chunk for loops that look at every access's result (The chunk and its
+// results stay in the host's L2 cache)
+const int ACCESS_CHUNK_SIZE = 4096;
+
+/****************************************************************************************
+ * Struct Name:         AccessResult
+ * Purpose:             Holds the outcome of one access: hit or miss, and the block
+ *                      that was replaced to make room, if any
+ ***************************************************************************************/
+struct AccessResult {
+    bool hit;
+    bool evicted;
+    bool evictedDirty;
+    Address evictedAddress;             // First address of the replaced block
+};
+
+/****************************************************************************************
+ * Struct Name:         SetCounters
+ * Purpose:             Holds the demand accesses and hits of one cache set and the 
+ *                      blocks replaced in it (misses = accesses - hits)
+ ***************************************************************************************/
+struct SetCounters {
+    long long accesses;
+    long long hits;
+    long long evictions;
+    long long dirtyEvictions;
+};
+
+/****************************************************************************************
+ * Class Name:          CacheEngine
+ * Purpose:             Applies memory accesses to a Cache Table using the chosen
+ *                      mapping associativity and replacement policy.
+ ***************************************************************************************/
+class CacheEngine {
+    public:
+        CacheEngine();                              // Constructor
+
+        // User Functions
+        void SetEngine(Address mainMemorySize, int cacheSize, int blockSize,
+                int mappingAssociation, int replacementPolicy);
+        void SetShard(Address mainMemorySize, int cacheSize, int blockSize,
+                int mappingAssociation, int replacementPolicy, int shard, int shards);
+        AccessResult Access(Address address, bool isWrite);
+        AccessResult Access(Address address, bool isWrite, int nextUse);
+        void AccessChunk(const vector<TraceRecord> &chunk);
+        void AccessChunk(const vector<TraceRecord> &chunk, vector<AccessResult> &results);
+        AccessResult Fill(Address address, bool isDirty);
+        bool Probe(Address address);
+        AccessResult Invalidate(Address address);
+        void MergeShard(CacheEngine &shardEngine);
+        void Print(ostream &output);
+        static string CheckGeometry(int cacheSize, int blockSize, int mappingAssociation);
+
+        // Setter Function(s)
+        void SetWritePolicy(bool writeBack, bool writeAllocate, int writeBufferEntries);
+        void FlushWriteBuffer();
+
+        // Getter Functions
+        Address GetMMBlock(Address address);
+        int GetCMSet(Address address);
+        int GetFirstCMBlock(Address address);
+        int GetCacheSets();
+        long long GetTotalAccesses();
+        long long GetTotalHits();
+        SetCounters GetSetCounters(int set);
+        long long GetBytesRead();
+        long long GetBytesWritten();
+        long long GetCoalescedWrites();
+
+    private:
+        // Variables Set by User
+        int blockSize;
+        int mappingAssociation;
+        int replacementPolicy;
+        int accessPolicy;                   // Policy whose AccessWith runs
+        bool writeBack;                     // Write-back (1) or write-through (0)
+        bool writeAllocate;                 // Write-allocate (1) or no-write-allocate (0)
+
+        // Variables Calculated and Set by Program
+        int cacheSets;
+        bool powerOfTwoSets;                // Set number is a mask of the block number
+        int offset;
+        int index;
+        int tag;
+
+        // Sets owned by this engine (shard 0 of 1 owns every set)
+        int shard;
+        int shards;
+
+        // Cache State
+        CacheTable cacheMemoryTable;
+
+        // Replacement Policy State (Only the chosen policy is set up)
+        LRUPolicy lruPolicy;
+        FIFOPolicy fifoPolicy;
+        OptimalPolicy optimalPolicy;
+        TreePLRUPolicy plruPolicy;
+        SRRIPPolicy srripPolicy;
+        BRRIPPolicy brripPolicy;
+        RandomPolicy randomPolicy;
+        LFUPolicy lfuPolicy;
+        LRUListPolicy lruListPolicy;
+        FIFOListPolicy fifoListPolicy;
+
+        // Fully Associative Index (One set of at least FULLY_ASSOCIATIVE_LINES lines)
+        bool fullyAssociative;
+        BlockMap lineOfTag;                 // Line holding each cached tag
+        vector<int> freeLines;              // Lines emptied by Invalidate (min-heap)
+        int unusedLines;                    // Lines from here on were never filled
+
+        // Aggregate Counters
+        long long totalAccesses;
+        long long totalHits;
+
+        // Counters of each owned set (Stored in the same order as the sets' lines)
+        vector<SetCounters> setCounters;
+
+        // Traffic to and from the next level
+        long long bytesRead;
+        long long bytesWritten;
+        WriteBuffer writeBuffer;
+
+        // Helper Functions
+        AccessResult Dispatch(Address address, bool isWrite, int nextUse, bool isDemand);
+        template <class Policy>
+        AccessResult AccessWith(Policy &policy, Address address, bool isWrite, int nextUse,
+                bool isDemand);
+        void DispatchChunk(const vector<TraceRecord> &chunk, AccessResult* results);
+        template <class Policy>
+        void AccessChunkWith(Policy &policy, const vector<TraceRecord> &chunk,
+                AccessResult* results);
+        int FindLine(Address address);
+        WayProbe ProbeLines(int firstLine, unsigned long long lineTag);
+        int GetFreeLine();
+        void IndexLine(int line, bool replaced, unsigned long long lineTag);
+        unsigned long long MakeTag(Address address);
+        Address MakeAddress(unsigned long long lineTag, int set);
+        void WriteNext(Address address, int bytes);
+        int GetFirstLine(Address address);
+};
+
+/****************************************************************************************
+ * Function Name:       Access
+ * Input Parameters:    Address address - represents the main memory address to access
+ *                      bool isWrite - represents whether the access is a write
+ * Return Value:        AccessResult - represents whether the access was a hit and 
+ *                      which block it replaced
+ * Purpose:             Performs one memory access on the Cache Table with no
+ *                      knowledge of the future (every policy except OPT)
+ ***************************************************************************************/
+inline AccessResult CacheEngine::Access(Address address, bool isWrite) {
+    // Next use is only needed by OPT replacement
+    return Access(address, isWrite, NO_NEXT_USE);
+}
+
+/****************************************************************************************
+ * Function Name:       Access
+ * Input Parameters:    Address address - represents the main memory address to access
+ *                      bool isWrite - represents whether the access is a write
+ *                      int nextUse - represents the row of the next access to the
+ *                      same block (NO_NEXT_USE if there is none)
+ * Return Value:        AccessResult - represents whether the access was a hit and 
+ *                      which block it replaced
+ * Purpose:             Performs one memory access on the Cache Table and counts it
+ ***************************************************************************************/
+inline AccessResult CacheEngine::Access(Address address, bool isWrite, int nextUse) {
+    // Demand access from the CPU (or from the cache level above)
+    return Dispatch(address, isWrite, nextUse, true);
+}
+
+/****************************************************************************************
+ * Function Name:       Fill
+ * Input Parameters:    Address address - represents an address of the block to place
+ *                      bool isDirty - represents whether the block is dirty
+ * Return Value:        AccessResult - represents whether the block was already in the
+ *                      cache and which block was replaced to make room
+ * Purpose:             Places a block handed down by another cache level (a dirty
+ *                      writeback or an exclusive cache's victim). If the block is 
+ *                      already cached, it only becomes dirty if isDirty is set. Fills
+ *                      are not counted as accesses or hits and do not change the
+ *                      replacement order of a block already cached.
+ ***************************************************************************************/
+inline AccessResult CacheEngine::Fill(Address address, bool isDirty) {
+    // Not a demand access
+    return Dispatch(address, isDirty, NO_NEXT_USE, false);
+}
+
+/****************************************************************************************
+ * Function Name:       Probe
+ * Input Parameters:    Address - represents the main memory address
+ * Return Value:        bool - represents whether the address's block is cached
+ * Purpose:             Checks for the block without changing any state or counter
+ ***************************************************************************************/
+inline bool CacheEngine::Probe(Address address) {
+    // Block is cached if a line holds it
+    return FindLine(address) >= 0;
+}
+
+/****************************************************************************************
+ * Function Name:       Dispatch
+ * Input Parameters:    Address address - represents the main memory address to access
+ *                      bool isWrite - represents whether the access makes the block
+ *                      dirty
+ *                      int nextUse - represents the row of the next access to the
+ *                      same block (Only used by OPT)
+ *                      bool isDemand - represents whether this is a counted access
+ *                      (1) or a Fill (0)
+ * Return Value:        AccessResult - represents the outcome of AccessWith
+ * Purpose:             Runs the chosen replacement policy's copy of AccessWith
+ ***************************************************************************************/
+inline AccessResult CacheEngine::Dispatch(Address address, bool isWrite, int nextUse, bool isDemand) {
+    // Pick the chosen policy's access
+    switch(accessPolicy) {
+        case FIFO_POLICY:   return AccessWith(fifoPolicy, address, isWrite, nextUse, isDemand);
+        case OPT_POLICY:    return AccessWith(optimalPolicy, address, isWrite, nextUse, isDemand);
+        case PLRU_POLICY:   return AccessWith(plruPolicy, address, isWrite, nextUse, isDemand);
+        case SRRIP_POLICY:  return AccessWith(srripPolicy, address, isWrite, nextUse, isDemand);
+        case BRRIP_POLICY:  return AccessWith(brripPolicy, address, isWrite, nextUse, isDemand);
+        case RANDOM_POLICY: return AccessWith(randomPolicy, address, isWrite, nextUse, isDemand);
+        case LFU_POLICY:    return AccessWith(lfuPolicy, address, isWrite, nextUse, isDemand);
+        case LRU_LIST_POLICY:
+            return AccessWith(lruListPolicy, address, isWrite, nextUse, isDemand);
+        case FIFO_LIST_POLICY:
+            return AccessWith(fifoListPolicy, address, isWrite, nextUse, isDemand);
+        default:            return AccessWith(lruPolicy, address, isWrite, nextUse, isDemand);
+    }
+}
+
+/****************************************************************************************
+ * Function Name:       AccessWith
+ * Input Parameters:    Policy &policy - represents the replacement policy's state
+ *                      Address address - represents the main memory address to access
+ *                      bool isWrite - represents whether the access is a write
+ *                      int nextUse - represents the row of the next access to the
+ *                      same block (Only used by OPT)
+ *                      bool isDemand - represents whether this is a counted access
+ *                      (1) or a Fill from another cache level (0)
+ * Return Value:        AccessResult - represents whether the access was a hit and 
+ *                      which block it replaced
+ * Purpose:             Performs one memory access on the Cache Table
+ *
+ *                      A write hit marks the line dirty under write-back, or is sent
+ *                      on to the next level under write-through. A write miss under
+ *                      no-write-allocate is sent on without taking a line. Fills
+ *                      always keep the dirty bit they are given.
+ *
+ *                      3 Major components/cases occuring here:
+ *
+ *                          1. The engine is looking for a valid bit of 1 and a tag
+ *                          match to determine if the access is a hit
+ *
+ *                          2. The engine is searching for an empty cache memory
+ *                          block in the Cache Table to store tag info, valid bit,
+ *                          dirty bit, and data into.
+ *
+ *                          (Cases 1 and 2 are one pass over the set, ProbeSet,
+ *                          which compares several ways per instruction in wide
+ *                          sets. A large fully associative cache looks the tag
+ *                          up in its index instead, see ProbeLines.)
+ *
+ *                          3. The engine is replacing occupied cache memory blocks
+ *                          using the user's chosen replacement policy.
+ *
+ *                      Policy is one of the classes in "ReplacementPolicy.h" (or
+ *                      OptimalPolicy). Each one gets its own compiled copy of this
+ *                      function with the policy's functions inlined.
+ ***************************************************************************************/
+template <class Policy>
+AccessResult CacheEngine::AccessWith(Policy &policy, Address address, bool isWrite, int nextUse,
+        bool isDemand) {
+    // Declare result, a miss that replaced nothing until found otherwise
+    AccessResult result;
+    result.hit = false;
+    result.evicted = false;
+    result.evictedDirty = false;
+    result.evictedAddress = 0;
+
+    // Declare variable for temporary Tag
+    unsigned long long tempTag = MakeTag(address);
+
+    // Declare the set's place in this engine's table and its first line (firstCMBlock)
+    int ownedSet = GetCMSet(address) / shards;
+    int firstCMBlock = ownedSet * mappingAssociation;
+
+    // Declare the set's counters
+    SetCounters &counters = setCounters[ownedSet];
+
+    // Declare index variable for the line to fill in Case 2 or 3
+    int index = firstCMBlock;
+
+    // Count the access (Fills are not accesses)
+    if(isDemand) {
+        totalAccesses++;
+        counters.accesses++;
+    }
+
+    // Cases 1 and 2: Search the set for a Tag Match and an Empty Spot in one pass
+    WayProbe probe = ProbeLines(firstCMBlock, tempTag);
+
+    // Case 1: Tag Match (Valid bit of 1 and the same tag)
+    if(probe.hitWay >= 0) {
+        int line = firstCMBlock + probe.hitWay;
+
+        // If IsWrite operation, Set Dirty Bit to true on Cache Table
+        // (Write-through sends the word on and keeps the line clean)
+        if(isWrite) {
+            if(writeBack || !isDemand) {
+                cacheMemoryTable.SetDirtyBit(line, true);
+            }
+            else {
+                WriteNext(address, WORD_SIZE);
+            }
+        }
+
+        // Tell the Replacement Policy and count the Hit (Not for Fills)
+        if(isDemand) {
+            policy.Hit(line, nextUse);
+            totalHits++;
+            counters.hits++;
+        }
+
+        // Tag found, access is a hit
+        result.hit = true;
+        return result;
+    }
+
+    // No-write-allocate: write miss goes to the next level, no line is taken
+    if(isWrite && isDemand && !writeAllocate) {
+        WriteNext(address, WORD_SIZE);
+        return result;
+    }
+
+    // Case 2: Fill the first Empty Spot (valid bit of 0) found by the probe
+    if(probe.emptyWay >= 0) {
+        index = firstCMBlock + probe.emptyWay;
+    }
+
+    // Case 3: No Empty Spots, ask the Replacement Policy for the line to replace
+    else {
+        index = policy.GetVictim(firstCMBlock);
+
+        // Report the replaced block (Same set, so only the tag differs)
+        result.evicted = true;
+        result.evictedDirty = cacheMemoryTable.GetDirtyBit(index);
+        result.evictedAddress = MakeAddress(cacheMemoryTable.GetTag(index), GetCMSet(address));
+        counters.evictions++;
+
+        // Write the replaced dirty block back to the next level
+        if(result.evictedDirty) {
+            WriteNext(result.evictedAddress, blockSize);
+            counters.dirtyEvictions++;
+        }
+    }
+
+    // Read the block from the next level (Fills bring their own data)
+    if(isDemand) {
+        bytesRead += blockSize;
+
+        // Write-through sends the written word on as well
+        if(isWrite && !writeBack) {
+            WriteNext(address, WORD_SIZE);
+        }
+    }
+
+    // Index = empty block or the Replacement Policy's victim
+    // Replace item at index
+
+    // Set Valid Bit
+    cacheMemoryTable.SetValidBit(index, 1);
+
+    // Set Dirty Bit if isWrite operation, clear it otherwise (Never set by write-through)
+    cacheMemoryTable.SetDirtyBit(index, isWrite && (writeBack || !isDemand));
+
+    // Index the new tag (Fully associative only, before the old tag is overwritten)
+    if(fullyAssociative) {
+        IndexLine(index, result.evicted, tempTag);
+    }
+
+    // Set Tag (The data column, the main memory block, is rebuilt from tag and set)
+    cacheMemoryTable.SetTag(index, tempTag);
+
+    // Tell the Replacement Policy about the new block
+    policy.Fill(index, nextUse);
+
+    // Tag not found, access is a miss
+    return result;
+}
+
+/****************************************************************************************
+ * Function Name:       AccessChunkWith
+ * Input Parameters:    Policy &policy - represents the replacement policy's state
+ *                      const vector<TraceRecord> &chunk - represents decoded memory 
+ *                      accesses
+ *                      AccessResult* results - filled with each access's result, or
+ *                      NULL if the results are not needed
+ * Return Value:        void
+ * Purpose:             Runs AccessWith for every memory access of the chunk
+ ***************************************************************************************/
+template <class Policy>
+void CacheEngine::AccessChunkWith(Policy &policy, const vector<TraceRecord> &chunk,
+        AccessResult* results) {
+    // Perform each access in order (Keeping the result if asked for)
+    for(int i=0; i < (int)chunk.size(); i++) {
+        AccessResult result = AccessWith(policy, chunk[i].address, chunk[i].isWrite,
+                chunk[i].nextUse, true);
+        if(results != NULL) {
+            results[i] = result;
+        }
+    }
+}
+
+/****************************************************************************************
+ * Function Name:       GetMMBlock
+ * Input Parameters:    Address - represents the main memory address
+ * Return Value:        Address - represents the main memory block number
+ * Purpose:             Returns the main memory block number of the given address.
+ *                      Block sizes are powers of two (the offset bits), so the 
+ *                      division is a shift.
+ ***************************************************************************************/
+inline Address CacheEngine::GetMMBlock(Address address) {
+    // Main Memory Block Number = Main Memory Address / Block Size
+    return address >> offset;
+}
+
+/****************************************************************************************
+ * Function Name:       GetCMSet
+ * Input Parameters:    Address - represents the main memory address
+ * Return Value:        int - represents the cache memory set number
+ * Purpose:             Returns the cache memory set number the given address maps to
+ ***************************************************************************************/
+inline int CacheEngine::GetCMSet(Address address) {
+    // Cache Memory Set Number = MMBlock % cacheSets (A mask for a power of two)
+    if(powerOfTwoSets) {
+        return (int)(GetMMBlock(address) & (Address)(cacheSets - 1));
+    }
+    return (int)(GetMMBlock(address) % cacheSets);
+}
+
+/****************************************************************************************
+ * Function Name:       GetFirstCMBlock
+ * Input Parameters:    Address - represents the main memory address
+ * Return Value:        int - represents the first cache memory block of the set
+ * Purpose:             Returns the first cache memory block number the given address
+ *                      can be mapped to. The set's blocks are sequential, so the
+ *                      remaining blocks follow directly after this one.
+ ***************************************************************************************/
+inline int CacheEngine::GetFirstCMBlock(Address address) {
+    // First Cache Memory Block = Set Number * N
+    return GetCMSet(address) * mappingAssociation;
+}
+
+/****************************************************************************************
+ * Function Name:       FindLine
+ * Input Parameters:    Address - represents the main memory address
+ * Return Value:        int - represents the line holding the address's block in this
+ *                      engine's Cache Table, or -1 if the block is not cached
+ * Purpose:             Searches the address's set for a valid line with its tag
+ ***************************************************************************************/
+inline int CacheEngine::FindLine(Address address) {
+    // Tag and first line of the set
+    unsigned long long tempTag = MakeTag(address);
+    int firstCMBlock = GetFirstLine(address);
+
+    // Probe every line of the set
+    WayProbe probe = ProbeLines(firstCMBlock, tempTag);
+    if(probe.hitWay >= 0) {
+        return firstCMBlock + probe.hitWay;
+    }
+
+    return -1;
+}
+
+/****************************************************************************************
+ * Function Name:       ProbeLines
+ * Input Parameters:    int firstLine - represents the first line of the set
+ *                      unsigned long long lineTag - represents the packed tag to find
+ * Return Value:        WayProbe - represents the way holding the tag (hitWay) and
+ *                      the first invalid way (emptyWay), -1 if there is none
+ * Purpose:             Probes the set in the Cache Table, or, for a fully associative
+ *                      cache, looks the tag up in the index and takes the lowest
+ *                      free line from the free lines. Both give the same ways.
+ ***************************************************************************************/
+inline WayProbe CacheEngine::ProbeLines(int firstLine, unsigned long long lineTag) {
+    // Compare the tag with every line of the set
+    if(!fullyAssociative) {
+        return cacheMemoryTable.ProbeSet(firstLine, lineTag);
+    }
+
+    // One set starting at line 0, so a line is its own way (The empty way only
+    // matters on a miss)
+    WayProbe probe;
+    probe.hitWay = lineOfTag.Find((long long)lineTag);
+    probe.emptyWay = (probe.hitWay < 0) ? GetFreeLine() : -1;
+    return probe;
+}
+
+/****************************************************************************************
+ * Function Name:       GetFreeLine
+ * Input Parameters:    void
+ * Return Value:        int - represents the lowest invalid line, or -1 if every line
+ *                      of the fully associative cache is valid
+ * Purpose:             Returns the line the set probe would find empty first. Lines
+ *                      are filled in order until every line has been used, so only
+ *                      lines emptied by Invalidate, all below unusedLines, can come
+ *                      before the first unused line.
+ ***************************************************************************************/
+inline int CacheEngine::GetFreeLine() {
+    // Lowest invalidated line
+    if(!freeLines.empty()) {
+        return freeLines.front();
+    }
+
+    // First line never filled
+    return (unusedLines < mappingAssociation) ? unusedLines : -1;
+}
+
+/****************************************************************************************
+ * Function Name:       IndexLine
+ * Input Parameters:    int line - represents the line about to be filled
+ *                      bool replaced - represents whether the line's block is being
+ *                      replaced (0 = the line was the lowest free line)
+ *                      unsigned long long lineTag - represents the new block's tag
+ * Return Value:        void
+ * Purpose:             Moves a fully associative cache's index to the new block:
+ *                      drops the replaced tag or uses up the free line, then maps
+ *                      the new tag to the line. Called before the table's tag is
+ *                      overwritten.
+ ***************************************************************************************/
+inline void CacheEngine::IndexLine(int line, bool replaced, unsigned long long lineTag) {
+    // Replaced block is no longer cached
+    if(replaced) {
+        lineOfTag.Erase((long long)cacheMemoryTable.GetTag(line));
+    }
+
+    // Free line is taken (It is the lowest invalidated line or the first unused one)
+    else if(!freeLines.empty()) {
+        pop_heap(freeLines.begin(), freeLines.end(), greater<int>());
+        freeLines.pop_back();
+    }
+    else {
+        unusedLines++;
+    }
+
+    // New block's line
+    lineOfTag.Insert((long long)lineTag, line);
+}
+
+/****************************************************************************************
+ * Function Name:       MakeTag
+ * Input Parameters:    Address - represents the main memory address in decimal
+ * Return Value:        unsigned long long - represents the tag bits packed into an 
+ *                      integer
+ * Purpose:             Shifts off the offset and index bits of the address (divides
+ *                      the block number by the number of sets, when that is not a
+ *                      power of two) and masks the result down to the number of tag
+ *                      bits. Tags are compared as integers; they are only turned into
+ *                      1's and 0's when the Cache Table is printed.
+ ***************************************************************************************/
+inline unsigned long long CacheEngine::MakeTag(Address address) {
+    // Get Tag from Address by shifting off the offset and index bits
+    unsigned long long temp;
+    if(powerOfTwoSets) {
+        temp = GetMMBlock(address) >> index;
+    }
+    else {
+        temp = GetMMBlock(address) / cacheSets;
+    }
+
+    // Keep only the tag bits
+    if(tag < ADDRESS_BITS) {
+        temp = temp & ((1ULL << tag) - 1);
+    }
+
+    // Return packed tag
+    return temp;
+}
+
+/****************************************************************************************
+ * Function Name:       MakeAddress
+ * Input Parameters:    unsigned long long lineTag - represents the packed tag of a line
+ *                      int set - represents the cache set of the line
+ * Return Value:        Address - represents the first main memory address of the 
+ *                      block
+ * Purpose:             Rebuilds a cached block's address from its tag and set, the
+ *                      reverse of MakeTag and GetCMSet.
+ ***************************************************************************************/
+inline Address CacheEngine::MakeAddress(unsigned long long lineTag, int set) {
+    // Block Number = Tag * Sets + Set (tag bits followed by index bits)
+    Address block = (lineTag * cacheSets) + set;
+
+    // Main Memory Address = Block Number * Block Size
+    return block << offset;
+}
+
+/****************************************************************************************
+ * Function Name:       WriteNext
+ * Input Parameters:    Address address - represents the first address written
+ *                      int bytes - represents the number of bytes written
+ * Return Value:        void
+ * Purpose:             Sends a write to the next level, through the write buffer if
+ *                      there is one
+ ***************************************************************************************/
+inline void CacheEngine::WriteNext(Address address, int bytes) {
+    // A write never crosses a block
+    bytes = min(bytes, blockSize);
+
+    // No buffer, every write is traffic
+    if(writeBuffer.GetEntries() == 0) {
+        bytesWritten += bytes;
+        return;
+    }
+
+    // Buffer only sends what it drains
+    bytesWritten += writeBuffer.Write(address, bytes);
+}
+
+/****************************************************************************************
+ * Function Name:       GetFirstLine
+ * Input Parameters:    Address - represents the main memory address
+ * Return Value:        int - represents the first line of the set in this engine's
+ *                      Cache Table
+ * Purpose:             Returns where the address's set starts in this engine's Cache
+ *                      Table. Equals GetFirstCMBlock unless the engine is a shard,
+ *                      whose table only stores every shards-th set.
+ ***************************************************************************************/
+inline int CacheEngine::GetFirstLine(Address address) {
+    // Owned sets are stored one after another
+    return (GetCMSet(address) / shards) * mappingAssociation;
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,451 @@
+/****************************************************************************************
+ *  Memory Simulator: "CacheHierarchy.cpp"
+ *
+ *  Author:     Hannah Perkins
+ *  CWID:       11472559
+ *  Assignment: Lab #7
+ *
+ *  Date:       17 October 2026
+ *  Course:     ECE 487
+ *
+ *  Function:   Simulates a chain of cache levels (L1, L2, L3, ...) above main memory
+ *
+ *  Description: Cache Hierarchy Class that connects one Cache Engine per level. An
+ *          access that misses in a level goes on to the next level, and main memory
+ *          is read only when every level misses. Blocks replaced in a level are
+ *          handed to the next level according to the inclusion mode:
+ *
+ *              Inclusive   - every block in a level is also in all levels below it.
+ *                            The missed block is filled into every level it missed
+ *                            in, and a block replaced in a lower level is removed
+ *                            from all levels above it (back-invalidation).
+ *              Exclusive   - a block is in at most one level. A block found in a
+ *                            lower level moves up to L1, and every block replaced in
+ *                            a level (clean or dirty) moves down to the next level.
+ *              NINE        - non-inclusive, non-exclusive. The missed block is
+ *                            filled into every level it missed in, but nothing is
+ *                            back-invalidated, so an upper level can keep blocks the
+ *                            levels below have replaced.
+ *
+ *          All levels use write-back: a dirty block replaced in a level is written
+ *          to the next level (or to main memory after the last level). Only L1 sees
+ *          the CPU's writes.
+ *
+ *          Every level uses the same block size, so a block moves between levels
+ *          without being split or merged. Each level has its own cache size,
+ *          associativity, and replacement policy. OPT is not allowed, since the
+ *          trace is streamed and OPT needs every future access.
+ *
+ ***************************************************************************************/
+
+#ifndef CACHEHIERARCHY_CPP
+#define CACHEHIERARCHY_CPP
+
+#include "CacheEngine.h"
+#include "ReplacementPolicy.h"
+#include <iostream>
+#include <string>
+#include <vector>
+using namespace std;
+
+// Inclusion Modes
+const int INCLUSIVE_HIERARCHY = 0;
+const int EXCLUSIVE_HIERARCHY = 1;
+const int NINE_HIERARCHY = 2;
+
+/****************************************************************************************
+ * Function Name:       ParseInclusion
+ * Input Parameters:    char - represents the user's inclusion letter
+ * Return Value:        int - represents the inclusion mode
+ * Purpose:             Converts I, E, or N into an inclusion mode (Unknown letters
+ *                      are NINE)
+ ***************************************************************************************/
+int ParseInclusion(char letter) {
+    // Match letter to mode
+    switch(letter) {
+        case 'I':   return INCLUSIVE_HIERARCHY;
+        case 'E':   return EXCLUSIVE_HIERARCHY;
+        default:    return NINE_HIERARCHY;
+    }
+}
+
+/****************************************************************************************
+ * Function Name:       GetInclusionName
+ * Input Parameters:    int - represents the inclusion mode
+ * Return Value:        string - represents the name of the mode
+ * Purpose:             Returns the printed name of an inclusion mode
+ ***************************************************************************************/
+string GetInclusionName(int inclusion) {
+    // Match mode to name
+    switch(inclusion) {
+        case INCLUSIVE_HIERARCHY:   return "inclusive";
+        case EXCLUSIVE_HIERARCHY:   return "exclusive";
+        default:                    return "NINE";
+    }
+}
+
+/****************************************************************************************
+ * Struct Name:         CacheLevel
+ * Purpose:             Holds the configuration and results of one cache level
+ ***************************************************************************************/
+struct CacheLevel {
+    // Configuration
+    int cacheSize;
+    int mappingAssociation;
+    int replacementPolicy;
+
+    // Results
+    long long totalAccesses;
+    long long totalHits;
+    long long writebacks;               // Dirty blocks written to the next level
+    long long backInvalidations;        // Upper level copies removed (Inclusive only)
+};
+
+/****************************************************************************************
+ * Class Name:          CacheHierarchy
+ * Purpose:             Simulates a chain of cache levels above main memory
+ ***************************************************************************************/
+class CacheHierarchy {
+    public:
+        CacheHierarchy();                           // Constructor
+
+        // User Functions
+        void AddLevel(int cacheSize, int mappingAssociation, int replacementPolicy);
+        void SetHierarchy(Address mainMemorySize, int blockSize, int inclusion);
+        int Access(Address address, bool isWrite);
+        void Print();
+
+        // Getter Functions
+        int GetLevels();
+        CacheLevel GetLevel(int level);
+        long long GetMemoryReads();
+        long long GetMemoryWrites();
+
+    private:
+        // Variables Set by User
+        int blockSize;
+        int inclusion;
+        vector<CacheLevel> levels;
+
+        // Variables Calculated and Set by Program
+        vector<CacheEngine> engines;        // engines[0] is L1
+        long long memoryReads;              // Blocks read from main memory
+        long long memoryWrites;             // Blocks written to main memory
+
+        // Helper Functions
+        int FindLevel(Address address);
+        int AccessFill(Address address, bool isWrite);
+        int AccessExclusive(Address address, bool isWrite);
+        void HandleEviction(int level, AccessResult victim);
+        void PlaceVictim(int level, Address address, bool isDirty);
+};
+
+/****************************************************************************************
+ * Constructor
+ ***************************************************************************************/
+CacheHierarchy::CacheHierarchy() {
+    // No levels yet
+    blockSize = 1;
+    inclusion = NINE_HIERARCHY;
+    memoryReads = 0;
+    memoryWrites = 0;
+}
+
+/****************************************************************************************
+ * Function Name:       AddLevel
+ * Input Parameters:    int cacheSize - represents the size of the level in bytes
+ *                      int mappingAssociation - represents the N of N-way mapping
+ *                      int replacementPolicy - represents the level's replacement
+ *                      policy (see "ReplacementPolicy.h")
+ * Return Value:        void
+ * Purpose:             Adds a level below the levels added so far (first call is L1)
+ ***************************************************************************************/
+void CacheHierarchy::AddLevel(int cacheSize, int mappingAssociation, int replacementPolicy) {
+    // Declare level with empty results
+    CacheLevel level;
+    level.cacheSize = cacheSize;
+    level.mappingAssociation = mappingAssociation;
+    level.replacementPolicy = replacementPolicy;
+    level.totalAccesses = 0;
+    level.totalHits = 0;
+    level.writebacks = 0;
+    level.backInvalidations = 0;
+
+    // Add to the bottom of the chain
+    levels.push_back(level);
+}
+
+/****************************************************************************************
+ * Function Name:       SetHierarchy
+ * Input Parameters:    Address mainMemorySize - represents the size of main memory in bytes
+ *                      (0 = 2^64)
+ *                      int blockSize - represents the block size of every level
+ *                      int inclusion - represents the inclusion mode
+ * Return Value:        void
+ * Purpose:             Creates an empty Cache Engine for every level and resets all
+ *                      counters
+ ***************************************************************************************/
+void CacheHierarchy::SetHierarchy(Address mainMemorySize, int blockSize, int inclusion) {
+    // Store User Settings
+    this->blockSize = blockSize;
+    this->inclusion = inclusion;
+
+    // One engine per level
+    engines.clear();
+    engines.resize(levels.size());
+    for(int i=0; i < (int)levels.size(); i++) {
+        engines[i].SetEngine(mainMemorySize, levels[i].cacheSize, blockSize,
+                levels[i].mappingAssociation, levels[i].replacementPolicy);
+    }
+
+    // Reset counters
+    memoryReads = 0;
+    memoryWrites = 0;
+}
+
+/****************************************************************************************
+ * Function Name:       Access
+ * Input Parameters:    Address address - represents the main memory address to access
+ *                      bool isWrite - represents whether the CPU writes (1) or reads (0)
+ * Return Value:        int - represents the level that hit (0 = L1), or the number of
+ *                      levels if the block came from main memory
+ * Purpose:             Performs one CPU memory access on the hierarchy
+ ***************************************************************************************/
+int CacheHierarchy::Access(Address address, bool isWrite) {
+    // Exclusive levels move blocks up; the others fill every level that missed
+    if(inclusion == EXCLUSIVE_HIERARCHY) {
+        return AccessExclusive(address, isWrite);
+    }
+    return AccessFill(address, isWrite);
+}
+
+/****************************************************************************************
+ * Function Name:       Print
+ * Input Parameters:    void
+ * Return Value:        void
+ * Purpose:             Prints one row of results per level, then the main memory
+ *                      traffic
+ ***************************************************************************************/
+void CacheHierarchy::Print() {
+    // Print Title
+    cout << endl << levels.size() << "-level " << GetInclusionName(inclusion);
+    cout << " hierarchy, " << blockSize << " byte blocks:" << endl;
+
+    // Print Column Headers
+    cout << "level" << "\t" << "cache size" << "\t" << "n-way" << "\t" << "policy" << "\t";
+    cout << "accesses" << "\t" << "hits" << "\t\t" << "misses" << "\t\t" << "hit rate";
+    cout << "\t" << "writebacks" << "\t" << "back-invalidations" << endl;
+    cout << "----------------------------------------------------------------------";
+    cout << "------------------------------------------------------------------" << endl;
+
+    // Print Rows
+    for(int i=0; i < (int)levels.size(); i++) {
+        // Calculate hit rate (Guard against a level that was never reached)
+        double hitRate = 0;
+        if(levels[i].totalAccesses > 0) {
+            hitRate = 100.0 * ((double)levels[i].totalHits / (double)levels[i].totalAccesses);
+        }
+
+        // Print Configuration
+        cout << "L" << (i + 1) << "\t" << levels[i].cacheSize << "\t\t";
+        cout << levels[i].mappingAssociation << "\t";
+        cout << GetPolicyName(levels[i].replacementPolicy) << "\t";
+
+        // Print Results
+        cout << levels[i].totalAccesses << "\t\t" << levels[i].totalHits << "\t\t";
+        cout << (levels[i].totalAccesses - levels[i].totalHits) << "\t\t";
+        cout << hitRate << "%" << "\t\t" << levels[i].writebacks << "\t\t";
+        cout << levels[i].backInvalidations << endl;
+    }
+
+    // Print Main Memory Traffic
+    cout << endl << "Main memory reads = " << memoryReads << " blocks" << endl;
+    cout << "Main memory writes = " << memoryWrites << " blocks" << endl;
+}
+
+/****************************************************************************************
+ * Function Name:       GetLevels
+ * Input Parameters:    void
+ * Return Value:        int - represents the number of cache levels
+ * Purpose:             Returns the number of cache levels
+ ***************************************************************************************/
+int CacheHierarchy::GetLevels() {
+    // Return number of levels
+    return levels.size();
+}
+
+/****************************************************************************************
+ * Function Name:       GetLevel
+ * Input Parameters:    int - represents the level (0 = L1)
+ * Return Value:        CacheLevel - represents the level's configuration and results
+ * Purpose:             Returns the configuration and counters of one level
+ ***************************************************************************************/
+CacheLevel CacheHierarchy::GetLevel(int level) {
+    // Return level
+    return levels.at(level);
+}
+
+/****************************************************************************************
+ * Function Name:       GetMemoryReads
+ * Input Parameters:    void
+ * Return Value:        long long - represents the blocks read from main memory
+ * Purpose:             Returns the number of accesses that missed in every level
+ ***************************************************************************************/
+long long CacheHierarchy::GetMemoryReads() {
+    // Return memoryReads
+    return memoryReads;
+}
+
+/****************************************************************************************
+ * Function Name:       GetMemoryWrites
+ * Input Parameters:    void
+ * Return Value:        long long - represents the blocks written to main memory
+ * Purpose:             Returns the number of dirty blocks replaced in the last level
+ ***************************************************************************************/
+long long CacheHierarchy::GetMemoryWrites() {
+    // Return memoryWrites
+    return memoryWrites;
+}
+
+/****************************************************************************************
+ * Function Name:       FindLevel
+ * Input Parameters:    Address - represents the main memory address
+ * Return Value:        int - represents the first level holding the address's block,
+ *                      or the number of levels if no level holds it
+ * Purpose:             Searches the levels from L1 down without changing any state,
+ *                      and counts an access in every level searched
+ ***************************************************************************************/
+int CacheHierarchy::FindLevel(Address address) {
+    // Search from the top
+    int level = 0;
+    while(level < (int)levels.size()) {
+        // Count the access and stop at the first level with the block
+        levels[level].totalAccesses++;
+        if(engines[level].Probe(address)) {
+            levels[level].totalHits++;
+            return level;
+        }
+        level++;
+    }
+
+    // Block comes from main memory
+    memoryReads++;
+    return level;
+}
+
+/****************************************************************************************
+ * Function Name:       AccessFill
+ * Input Parameters:    Address address - represents the main memory address to access
+ *                      bool isWrite - represents whether the CPU writes (1) or reads (0)
+ * Return Value:        int - represents the level that hit
+ * Purpose:             Inclusive and NINE access. The level that hit is accessed
+ *                      first (so its replacement policy sees the hit), then the block
+ *                      is filled into each level that missed, from the bottom up, so
+ *                      each level's replaced block finds its next level up to date.
+ ***************************************************************************************/
+int CacheHierarchy::AccessFill(Address address, bool isWrite) {
+    // Level that holds the block
+    int hitLevel = FindLevel(address);
+
+    // Access the levels from the one that hit up to L1 (Only L1 sees the write)
+    int start = min(hitLevel, (int)levels.size() - 1);
+    for(int i = start; i >= 0; i--) {
+        AccessResult result = engines[i].Access(address, isWrite && (i == 0));
+        if(result.evicted) {
+            HandleEviction(i, result);
+        }
+    }
+
+    return hitLevel;
+}
+
+/****************************************************************************************
+ * Function Name:       AccessExclusive
+ * Input Parameters:    Address address - represents the main memory address to access
+ *                      bool isWrite - represents whether the CPU writes (1) or reads (0)
+ * Return Value:        int - represents the level that hit
+ * Purpose:             Exclusive access. A block found below L1 is removed from its
+ *                      level and moved into L1 (keeping its dirty bit). The block L1
+ *                      replaces moves down one level.
+ ***************************************************************************************/
+int CacheHierarchy::AccessExclusive(Address address, bool isWrite) {
+    // Level that holds the block
+    int hitLevel = FindLevel(address);
+
+    // Take the block out of the lower level that held it
+    bool isDirty = false;
+    if((hitLevel > 0) && (hitLevel < (int)levels.size())) {
+        isDirty = engines[hitLevel].Invalidate(address).evictedDirty;
+    }
+
+    // Access L1 (A dirty block stays dirty in L1)
+    AccessResult result = engines[0].Access(address, isWrite || isDirty);
+    if(result.evicted) {
+        HandleEviction(0, result);
+    }
+
+    return hitLevel;
+}
+
+/****************************************************************************************
+ * Function Name:       HandleEviction
+ * Input Parameters:    int level - represents the level that replaced a block
+ *                      AccessResult victim - represents the replaced block
+ * Return Value:        void
+ * Purpose:             Sends a replaced block on to the next level. Inclusive levels
+ *                      first remove the block from every level above (a dirty upper
+ *                      copy makes the block dirty). Dirty blocks are written back;
+ *                      exclusive levels also move clean blocks down.
+ ***************************************************************************************/
+void CacheHierarchy::HandleEviction(int level, AccessResult victim) {
+    // Dirty bit of the block
+    bool isDirty = victim.evictedDirty;
+
+    // Back-invalidate upper levels to keep inclusion
+    if(inclusion == INCLUSIVE_HIERARCHY) {
+        for(int i=0; i < level; i++) {
+            AccessResult upper = engines[i].Invalidate(victim.evictedAddress);
+            if(upper.evicted) {
+                levels[level].backInvalidations++;
+                isDirty = isDirty || upper.evictedDirty;
+            }
+        }
+    }
+
+    // Count the writeback
+    if(isDirty) {
+        levels[level].writebacks++;
+    }
+
+    // Send the block down
+    if(isDirty || (inclusion == EXCLUSIVE_HIERARCHY)) {
+        PlaceVictim(level + 1, victim.evictedAddress, isDirty);
+    }
+}
+
+/****************************************************************************************
+ * Function Name:       PlaceVictim
+ * Input Parameters:    int level - represents the level receiving the block
+ *                      Address address - represents the first address of the block
+ *                      bool isDirty - represents whether the block is dirty
+ * Return Value:        void
+ * Purpose:             Places a block replaced by the level above. Below the last
+ *                      level, dirty blocks are written to main memory.
+ ***************************************************************************************/
+void CacheHierarchy::PlaceVictim(int level, Address address, bool isDirty) {
+    // Below the last level is main memory
+    if(level == (int)levels.size()) {
+        if(isDirty) {
+            memoryWrites++;
+        }
+        return;
+    }
+
+    // Fill the block (May replace another block in this level)
+    AccessResult result = engines[level].Fill(address, isDirty);
+    if(result.evicted) {
+        HandleEviction(level, result);
+    }
+}
+
+#endif
\ No newline at end of file
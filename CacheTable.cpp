@@ -9,65 +9,44 @@
  *  Course:     ECE 487
  * 
  *  Function:   Simulates the Cache Table rows and columns
- * 
- *  Description: Cache Table Class that simulates how the cache would look after a 
- *          series of read and write operations. 
- *  
+ *
+ *  Description: Defines the CacheTable functions that set up, copy, and print the
+ *          table. The row getters and setters used by every access are inline in
+ *          "CacheTable.h". The data column is rebuilt from each line's tag and set
+ *          when printed. SetCache works out the size of a set block and places the
+ *          first block on a CACHE_LINE_BYTES boundary.
+ *
  ***************************************************************************************/
 
+#include "CacheTable.h"
 #include <iostream>
-#include <string>
-#include <vector>
-#include <math.h>
+#include <string.h>
+#include <stdint.h>
 using namespace std;
 
 /****************************************************************************************
- * Class Name:          CacheTable
- * Purpose:             Simulates the rows and columns of the Cache Memory Table
+ * Constructor
  ***************************************************************************************/
-class CacheTable {
-    public: 
-        CacheTable();                               // Constructor
-        ~CacheTable();                              // Destructor
-
-        // User Functions
-        void SetCache(int lines, int tag);
-        void Print();
-
-        // Getter Functions
-        bool GetValidBit(int index);
-        string GetBinaryTag(int index);
-        int GetTimeClock(int index);
-
-        // Setter Functions
-        void SetDirtyBit(int index, bool newBit);
-        void SetValidBit(int index, bool newBit);
-        void SetBinaryTag(int index, int address, int totalAddressSize);
-        void SetData(int index, int mmBlock);
-        void SetTimeClock(int index);
-
-    private:
-        // Variables Populated by User Settings/Input
-        int cacheLines;
-        int tagSize;
-
-        // Variables for Cache Memory Rows
-        vector<bool> dirtyBit;
-        vector<bool> validBit;
-        vector<string> binaryTag;
-        vector<string> data;
-
-        // Time Variables
-        int virtualClock;
-        vector<int> timeClock;
-};
+CacheTable::CacheTable() {
+    // Empty table until SetCache is called
+    cacheLines = 0;
+    tagSize = 0;
+    mappingAssociation = 1;
+    isWideTag = false;
+    waysShift = 0;
+    validOffset = 0;
+    flagsOffset = 0;
+    setBytes = 0;
+    sets = NULL;
+}
 
 /****************************************************************************************
- * Constructor
+ * Copy Constructor
  ***************************************************************************************/
-CacheTable::CacheTable() {
-    // Initialize virtualClock to 0
-    virtualClock = 0;
+CacheTable::CacheTable(const CacheTable &source) {
+    // No storage yet, then copy the source's rows
+    sets = NULL;
+    *this = source;
 }
 
 /****************************************************************************************
@@ -75,223 +54,214 @@ CacheTable::CacheTable() {
  ***************************************************************************************/
 CacheTable::~CacheTable() {
     // Clear Vectors to free up memory space for next simulation
-    dirtyBit.clear();
-    validBit.clear();
-    binaryTag.clear();
-    data.clear();
-    timeClock.clear();
+    storage.clear();
+    sets = NULL;
+}
+
+/****************************************************************************************
+ * Function Name:       operator=
+ * Input Parameters:    const CacheTable &source - represents the table to copy
+ * Return Value:        CacheTable& - represents this table
+ * Purpose:             Copies the layout and every set block of another table. The
+ *                      blocks are copied from the source's first block rather than
+ *                      with the storage vector, since the new storage may reach a
+ *                      CACHE_LINE_BYTES boundary after a different number of bytes.
+ ***************************************************************************************/
+CacheTable& CacheTable::operator=(const CacheTable &source) {
+    // Copying a table onto itself changes nothing
+    if(this == &source) {
+        return *this;
+    }
+
+    // Copy Layout
+    cacheLines = source.cacheLines;
+    tagSize = source.tagSize;
+    mappingAssociation = source.mappingAssociation;
+    isWideTag = source.isWideTag;
+    waysShift = source.waysShift;
+    validOffset = source.validOffset;
+    flagsOffset = source.flagsOffset;
+    setBytes = source.setBytes;
+
+    // Copy Set Blocks
+    storage.assign(source.storage.size(), 0);
+    AlignStorage();
+    if(source.sets != NULL) {
+        memcpy(sets, source.sets, (size_t)(cacheLines / mappingAssociation) * setBytes);
+    }
+
+    return *this;
 }
 
 /****************************************************************************************
  * Function Name:       SetCache
  * Input Parameters:    int lines - represents number of cache lines are available
  *                      int tag - represents number of tag bits
+ *                      int mappingAssociation - represents the N of N-way mapping
+ *                      (used to find each line's set when printing its data)
  * Return Value:        void
  * Purpose:             Initializes the sizes of all vecctors/rows of the table. Sets
- *                      all dirty bits and valid bits to 0. Sets data bits to "xxx" 
- *                      and tag bits to correct size of 'don't-cares'. Also sets the
- *                      vector size of time clock and sets all values to 0.
+ *                      all dirty bits and valid bits to 0. Marks every line unused,
+ *                      so its data is printed as "xxx", and sets all packed tags to
+ *                      0. (Tags of invalid lines are printed as 'don't-cares'.) 
+ *                      Tags longer than 32 bits are stored in 64 bits instead of
+ *                      32. Every set gets one block, laid out as described in
+ *                      "CacheTable.h". Replacement policy state (such as the LRU/FIFO 
+ *                      time clock) is kept by the Cache Engine's policy.
  *                      TLDR: Creates default cache table
  ***************************************************************************************/
-void CacheTable::SetCache(int lines, int tag) {
+void CacheTable::SetCache(int lines, int tag, int mappingAssociation) {
     // Set cacheLines and tagSize integers
     cacheLines = lines;
     tagSize = tag;
-
-    // Create temp Variable for binary tag
-    string tempTag = "";
-
-    for(int i=0; i<tagSize; i++) {
-        tempTag += "x";
+    this->mappingAssociation = mappingAssociation;
+
+    // Rows are found by shift and mask when the association is a power of 2
+    waysShift = -1;
+    for(int shift = 0; (1 << shift) <= mappingAssociation; shift++) {
+        if((1 << shift) == mappingAssociation) {
+            waysShift = shift;
+        }
     }
 
-    // Set size of dirty and valid bits
-    // Initialize all to 0
-    dirtyBit.resize(cacheLines, 0);
-    validBit.resize(cacheLines, 0);
+    // Block Layout: packed tags in the narrowest width that holds them, then the
+    // valid bytes, then the flag bytes
+    isWideTag = (tagSize > 32);
+    int tagBytes = isWideTag ? sizeof(unsigned long long) : sizeof(unsigned int);
+    validOffset = mappingAssociation * tagBytes;
+    flagsOffset = validOffset + mappingAssociation;
+
+    // Pad a block to a power of 2 below a host cache line, or to whole host cache lines
+    setBytes = flagsOffset + mappingAssociation;
+    if(setBytes < (size_t)CACHE_LINE_BYTES) {
+        size_t padded = 1;
+        while(padded < setBytes) {
+            padded = padded << 1;
+        }
+        setBytes = padded;
+    }
+    else {
+        setBytes = (setBytes + CACHE_LINE_BYTES - 1) / CACHE_LINE_BYTES * CACHE_LINE_BYTES;
+    }
 
-    // Initialize binary tag bits
-    binaryTag.resize(cacheLines, tempTag);
+    // Allocate every set's block, with room to move the first one to a boundary
+    // Initialize all tags, valid bytes, and flags (dirty, used) to 0
+    storage.assign((size_t)(cacheLines / mappingAssociation) * setBytes + CACHE_LINE_BYTES, 0);
+    AlignStorage();
+}
 
-    // Initialize data bits
-    data.resize(cacheLines, "xxx");
+/****************************************************************************************
+ * Function Name:       AlignStorage
+ * Input Parameters:    void
+ * Return Value:        void
+ * Purpose:             Points sets at the first CACHE_LINE_BYTES boundary in storage
+ ***************************************************************************************/
+void CacheTable::AlignStorage() {
+    // Empty table has no blocks
+    if(storage.empty()) {
+        sets = NULL;
+        return;
+    }
 
-    // Initialize timeClock to 0
-    timeClock.resize(cacheLines, 0);
+    // Skip the bytes before the boundary
+    uintptr_t start = (uintptr_t)storage.data();
+    sets = storage.data() + ((CACHE_LINE_BYTES - (start % CACHE_LINE_BYTES)) % CACHE_LINE_BYTES);
 }
 
 /****************************************************************************************
  * Function Name:       Print
- * Input Parameters:    void
+ * Input Parameters:    ostream& - represents the console or file to print to
  * Return Value:        void
  * Purpose:             Prints the cache table as it would appear in cache memory. 
  *                      Prints cache block numbers, dirty bits, valid bits, tag bits,
- *                      and data of each cache line address.
+ *                      and data of each cache line address. Lines end with '\n'
+ *                      rather than endl, so the output is not flushed every row.
  ***************************************************************************************/
-void CacheTable::Print() {
+void CacheTable::Print(ostream &output) {
     // Print Title
-    cout << endl << "Final \"status\" of the cache:" << endl;
+    output << "\nFinal \"status\" of the cache:\n";
 
     // Print Column Headers
-    cout << "cache blk #" << "\t\t" << "dirty bit" << "\t" << "valid bit";
-    cout << "\t" << "tag" << "\t\t" << "data" << endl;
-    cout << "----------------------------------------------------------------------";
-    cout << "--------------" << endl;
+    output << "cache blk #" << "\t\t" << "dirty bit" << "\t" << "valid bit";
+    output << "\t" << "tag" << "\t\t" << "data\n";
+    output << "----------------------------------------------------------------------";
+    output << "--------------\n";
+
+    // Number of sets (Every set has mappingAssociation lines)
+    Address sets = cacheLines / mappingAssociation;
 
     // Print Rows
     for(int i=0; i < cacheLines; i++) {
         // Print Cache Block Number
-        cout << "\t" << i;
+        output << "\t" << i;
 
         // Print Dirty Bit
-        cout << "\t\t" << dirtyBit.at(i);
+        output << "\t\t" << GetDirtyBit(i);
 
         // Print Valid Bit
-        cout << "\t\t" << validBit.at(i);
-
-        // Print Binary Tag
-        cout << "\t\t" << binaryTag.at(i);
-
-        // Print Data
-        cout << "\t\t" << data.at(i); 
-        cout << endl;
+        output << "\t\t" << GetValidBit(i);
+
+        // Print Binary Tag (Tag of an invalid line is all 'don't-cares')
+        if(GetValidBit(i)) {
+            output << "\t\t" << MakeBinaryString(GetTag(i));
+        }
+        else {
+            output << "\t\t" << string(tagSize, 'x');
+        }
+
+        // Print Data (Main Memory Block = Tag * Sets + Set, only turned into text here)
+        int way;
+        if(!(GetSetBlock(i, way)[flagsOffset + way] & USED_FLAG)) {
+            output << "\t\t" << "xxx";
+        }
+        else {
+            output << "\t\t" << "mm blk # " << ((GetTag(i) * sets) + (i / mappingAssociation));
+        }
+        output << "\n";
     }
 }
 
 /****************************************************************************************
- * Function Name:       GetValidBit
- * Input Parameters:    int - represents the cache row index to access
- * Return Value:        bool - represents the status of the valid bit
- *                              (1 = Valid, 0 = Invalid)
- * Purpose:             Returns the valid bit of the the given indexed cache row
- ***************************************************************************************/
-bool CacheTable::GetValidBit(int index) {
-    // Return the valid bit at given index
-    return validBit.at(index);
-}
-
-/****************************************************************************************
- * Function Name:       GetBinaryTag
- * Input Parameters:    int - represents the cache row index to access
- * Return Value:        string - represents the binary tag at the given index
- * Purpose:             Returns the binary tag from the given index as a string of 1's 
- *                      and 0's.
- ***************************************************************************************/
-string CacheTable::GetBinaryTag(int index) {
-    // Return the binaryTag at given Index
-    return binaryTag.at(index);
-}
-
-/****************************************************************************************
- * Function Name:       GetTimeClock
- * Input Parameters:    int - represents the cache row index to access
- * Return Value:        int - represents the number of operations to occur as time 
- *                      passes. (Using this count of operations as an internal clock to
- *                      keep track of items that were most recently used as well as 
- *                      which items were entered first)
- * Purpose:             Returns the "virtual" clock integer indicating how many total 
- *                      read and write operations were performed at the time of when 
- *                      this item was set.
- ***************************************************************************************/
-int CacheTable::GetTimeClock(int index) {
-    // Return timeClock at given index
-    return timeClock.at(index);
-}
-
-/****************************************************************************************
- * Function Name:       SetDirtyBit
+ * Function Name:       CopyLine
  * Input Parameters:    int index - represents the cache row index to change
- *                      bool newBit - represents the value that dirty bit will be set to
+ *                      CacheTable &source - represents the table to copy from
+ *                      int sourceIndex - represents the row index in source to copy
  * Return Value:        void
- * Purpose:             Sets the dirty bit value to newBit value at the given index
+ * Purpose:             Copies the dirty bit, valid bit, used bit, and tag of a row of
+ *                      another Cache Table (with the same tag size) into the given row.
  ***************************************************************************************/
-void CacheTable::SetDirtyBit(int index, bool newBit) {
-    // Set the dirtyBit at index equal to the bool newBit
-    dirtyBit.at(index) = newBit;
+void CacheTable::CopyLine(int index, CacheTable &source, int sourceIndex) {
+    // Copy Row (Flags last, since SetTag marks the line used)
+    SetValidBit(index, source.GetValidBit(sourceIndex));
+    SetTag(index, source.GetTag(sourceIndex));
+    int way, sourceWay;
+    unsigned char* block = GetSetBlock(index, way);
+    unsigned char* sourceBlock = source.GetSetBlock(sourceIndex, sourceWay);
+    block[flagsOffset + way] = sourceBlock[source.flagsOffset + sourceWay];
 }
 
 /****************************************************************************************
- * Function Name:       SetValidBit
- * Input Parameters:    int index - represents the cache row index to change
- *                      int newBit - represents the value that valid bit will be set to
- * Return Value:        void
- * Purpose:             Sets the valid bit value to newBit value at the given index
+ * Function Name:       MakeBinaryString
+ * Input Parameters:    unsigned long long - represents a packed tag
+ * Return Value:        string - represents the tag as a string of 1's and 0's
+ * Purpose:             Converts a packed tag into a binary string that is tagSize 
+ *                      characters long. Used only when printing the cache table.
  ***************************************************************************************/
-void CacheTable::SetValidBit(int index, bool newBit) {
-    // Set the validBit at index equal to the bool newBit
-    validBit.at(index) = newBit;
-}
+string CacheTable::MakeBinaryString(unsigned long long value) {
+    // Declare temporary String variable sized to the number of tag bits
+    string temp(tagSize, '0');
 
-/****************************************************************************************
- * Function Name:       SetBinaryTag
- * Input Parameters:    int index - represents the cache row index to change
- *                      int address - represents the main memory address as a decimal
- *                      number
- *                      int totalAddressSize - represents the total number of bits for
- *                      the main memory address
- * Return Value:        void
- * Purpose:             Uses a given main memory address and total address bit size to 
- *                      calculate and convert the tag into a string of 1's and 0's
- ***************************************************************************************/
-void CacheTable::SetBinaryTag(int index, int address, int totalAddressSize) {
-    // Declare temporary String variable
-    string temp = "";
-    
-    // Get Tag from Address
-    for(int i=0; i < (totalAddressSize - tagSize); i++) {
-        // Shift Right
-        address = address / 2;
-    }
-
-    // Convert Tag to Binary
-    for(int i=0; i < tagSize; i++) {
-        // Find LSB
-        temp = to_string(address % 2) + temp;
+    // Fill in bits starting from the LSB (last character)
+    for(int i = tagSize - 1; i >= 0; i--) {
+        // Set character to 1 if LSB is set
+        if(value & 1) {
+            temp[i] = '1';
+        }
 
-        // Shift Right 
-        address = address / 2;
+        // Shift Right
+        value = value >> 1;
     }
 
-    // Set binaryTag to temp
-    binaryTag.at(index) = temp;
-}
-
-/****************************************************************************************
- * Function Name:       SetData
- * Input Parameters:    int index - represents the cache row index to change
- *                      int mmBlock - represents the main memory block to save to the 
- *                      data field
- * Return Value:        void
- * Purpose:             Stores the given main memory block in the data field at the
- *                      given cache row index. Data is stored as a string.
- ***************************************************************************************/
-void CacheTable::SetData(int index, int mmBlock) {
-    // Declare variable for temporary string
-    string temp = "mm blk # ";
-
-    // Append mmBlock number to temp string
-    temp += to_string(mmBlock);
-
-    // Set data at index equal to temp string
-    data.at(index) = temp;
-}
-
-/****************************************************************************************
- * Function Name:       SetTimeClock
- * Input Parameters:    int - represents the cache row index to change
- * Return Value:        void
- * Purpose:             Increments the "virtual clock" by one and also sets the 
- *                      timeClock element at a given index to the "virtual clock"
- *                      value. The "Virtual clock" value indicates how many total
- *                      read and write operations have occurred at this given time.
- *                      This function is only called when a read or write occurs
- *                      and is necessary in order to implement LRU and FIFO
- *                      replacement policies.
- ***************************************************************************************/
-void CacheTable::SetTimeClock(int index) {
-    // Increment Virtual Clock
-    virtualClock++;
-
-    // Set time Clock at index to equal virtual clock
-    timeClock.at(index) = virtualClock;
+    // Return temp string
+    return temp;
 }
\ No newline at end of file
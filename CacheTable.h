@@ -0,0 +1,253 @@
+/****************************************************************************************
+ *  Memory Simulator: "CacheTable.h"
+ * 
+ *  Author:     Hannah Perkins
+ *  CWID:       11472559
+ *  Assignment: Lab #7
+ * 
+ *  Date:       7 April 2021
+ *  Course:     ECE 487
+ * 
+ *  Function:   Simulates the Cache Table rows and columns
+ * 
+ *  Description: Cache Table Class that simulates how the cache would look after a 
+ *          series of read and write operations. 
+ * 
+ *              Tags of up to 32 bits are stored in 32 bits each; only a table with
+ *          longer tags (large 64-bit address spaces) stores 64 bits per tag. The
+ *          data column is not stored: a line's main memory block is rebuilt from 
+ *          its tag and set when the table is printed.
+ * 
+ *              The rows are stored set by set. Each set is one block holding the
+ *          tags of its lines, then one valid byte per line, then one flag byte per
+ *          line (dirty and used bits):
+ *
+ *              | tag 0 | tag 1 | ... | valid 0 | valid 1 | ... | flags 0 | ... |
+ *
+ *          Blocks smaller than CACHE_LINE_BYTES are padded to a power of two, larger
+ *          ones to a multiple of CACHE_LINE_BYTES, and the first block starts on a
+ *          CACHE_LINE_BYTES boundary, so no set straddles more host cache lines
+ *          than it needs. An access touches its set's block and nothing else in
+ *          the table. The valid bytes sit next to each other, so ProbeSet can check
+ *          a whole set's tags and valid bits with vector instructions (see
+ *          "WayProbe.h"). A line costs 6 bytes (10 with 64-bit tags) plus padding.
+ *  
+ ***************************************************************************************/
+
+#ifndef CACHETABLE_H
+#define CACHETABLE_H
+
+#include <ostream>
+#include <string>
+#include <vector>
+#include <math.h>
+#include "Address.h"
+#include "WayProbe.h"
+using namespace std;
+
+// Size of a host cache line, in bytes (Set blocks are aligned to it)
+const int CACHE_LINE_BYTES = 64;
+
+// Bits of a line's flag byte
+const unsigned char DIRTY_FLAG = 1;
+const unsigned char USED_FLAG = 2;              // Line has held a block (data shown)
+
+/****************************************************************************************
+ * Class Name:          CacheTable
+ * Purpose:             Simulates the rows and columns of the Cache Memory Table
+ ***************************************************************************************/
+class CacheTable {
+    public: 
+        CacheTable();                               // Constructor
+        CacheTable(const CacheTable &source);       // Copy Constructor
+        ~CacheTable();                              // Destructor
+        CacheTable& operator=(const CacheTable &source);
+
+        // User Functions
+        void SetCache(int lines, int tag, int mappingAssociation);
+        void Print(ostream &output);
+
+        // Getter Functions
+        bool GetValidBit(int index);
+        bool GetDirtyBit(int index);
+        unsigned long long GetTag(int index);
+        WayProbe ProbeSet(int firstLine, unsigned long long tag);
+
+        // Setter Functions
+        void SetDirtyBit(int index, bool newBit);
+        void SetValidBit(int index, bool newBit);
+        void SetTag(int index, unsigned long long newTag);
+        void CopyLine(int index, CacheTable &source, int sourceIndex);
+
+    private:
+        // Variables Populated by User Settings/Input
+        int cacheLines;
+        int tagSize;
+        int mappingAssociation;
+
+        // Set Block Layout
+        bool isWideTag;                             // Tags longer than 32 bits (64-bit tags)
+        int waysShift;                              // log2(mappingAssociation), -1 if not a power of 2
+        int validOffset;                            // Offset of the valid bytes in a block
+        int flagsOffset;                            // Offset of the flag bytes in a block
+        size_t setBytes;                            // Size of a padded set block
+
+        // Variables for Cache Memory Rows (Every set's block, starting at sets)
+        vector<unsigned char> storage;
+        unsigned char* sets;                        // First CACHE_LINE_BYTES boundary in storage
+
+        // Helper Functions
+        void AlignStorage();
+        unsigned char* GetSetBlock(int index, int &way);
+        string MakeBinaryString(unsigned long long value);
+};
+
+/****************************************************************************************
+ * Function Name:       GetSetBlock
+ * Input Parameters:    int index - represents the cache row index to access
+ *                      int &way - set to the row's position within its set
+ * Return Value:        unsigned char* - represents the block of the row's set
+ * Purpose:             Finds the set block holding a row. A shift and mask when the
+ *                      association is a power of two, which is the usual case.
+ ***************************************************************************************/
+inline unsigned char* CacheTable::GetSetBlock(int index, int &way) {
+    // Set and Way of the row
+    int set;
+    if(waysShift >= 0) {
+        set = index >> waysShift;
+        way = index & (mappingAssociation - 1);
+    }
+    else {
+        set = index / mappingAssociation;
+        way = index % mappingAssociation;
+    }
+
+    return sets + (size_t)set * setBytes;
+}
+
+/****************************************************************************************
+ * Function Name:       GetValidBit
+ * Input Parameters:    int - represents the cache row index to access
+ * Return Value:        bool - represents the status of the valid bit
+ *                              (1 = Valid, 0 = Invalid)
+ * Purpose:             Returns the valid bit of the the given indexed cache row
+ ***************************************************************************************/
+inline bool CacheTable::GetValidBit(int index) {
+    // Return the valid byte at given index
+    int way;
+    unsigned char* block = GetSetBlock(index, way);
+    return block[validOffset + way] != 0;
+}
+
+/****************************************************************************************
+ * Function Name:       GetDirtyBit
+ * Input Parameters:    int - represents the cache row index to access
+ * Return Value:        bool - represents the status of the dirty bit
+ *                              (1 = Dirty, 0 = Clean)
+ * Purpose:             Returns the dirty bit of the the given indexed cache row
+ ***************************************************************************************/
+inline bool CacheTable::GetDirtyBit(int index) {
+    // Return the dirty flag at given Index
+    int way;
+    unsigned char* block = GetSetBlock(index, way);
+    return (block[flagsOffset + way] & DIRTY_FLAG) != 0;
+}
+
+/****************************************************************************************
+ * Function Name:       GetTag
+ * Input Parameters:    int - represents the cache row index to access
+ * Return Value:        unsigned long long - represents the packed tag at the given 
+ *                      index
+ * Purpose:             Returns the tag from the given index as a packed integer so 
+ *                      tag comparisons are a single integer compare. The width check
+ *                      takes the same branch for every line of a table.
+ ***************************************************************************************/
+inline unsigned long long CacheTable::GetTag(int index) {
+    // Return the packed tag at given Index from the set's tags
+    int way;
+    unsigned char* block = GetSetBlock(index, way);
+    if(isWideTag) {
+        return ((unsigned long long*)block)[way];
+    }
+    return ((unsigned int*)block)[way];
+}
+
+/****************************************************************************************
+ * Function Name:       ProbeSet
+ * Input Parameters:    int firstLine - represents the first line of the set
+ *                      unsigned long long tag - represents the packed tag to find
+ * Return Value:        WayProbe - represents the way holding the tag (hitWay) and
+ *                      the first invalid way (emptyWay), -1 if there is none
+ * Purpose:             Searches every line of a set for a valid line with the tag,
+ *                      and for an empty line, in one pass over the set's block
+ ***************************************************************************************/
+inline WayProbe CacheTable::ProbeSet(int firstLine, unsigned long long tag) {
+    // Probe the set's tags and valid bytes
+    int way;
+    unsigned char* block = GetSetBlock(firstLine, way);
+    if(isWideTag) {
+        return ProbeWays((unsigned long long*)block, block + validOffset, tag, mappingAssociation);
+    }
+    return ProbeWays((unsigned int*)block, block + validOffset, (unsigned int)tag,
+            mappingAssociation);
+}
+
+/****************************************************************************************
+ * Function Name:       SetDirtyBit
+ * Input Parameters:    int index - represents the cache row index to change
+ *                      bool newBit - represents the value that dirty bit will be set to
+ * Return Value:        void
+ * Purpose:             Sets the dirty bit value to newBit value at the given index
+ ***************************************************************************************/
+inline void CacheTable::SetDirtyBit(int index, bool newBit) {
+    // Set or clear the dirty flag at index
+    int way;
+    unsigned char* flags = GetSetBlock(index, way) + flagsOffset;
+    if(newBit) {
+        flags[way] |= DIRTY_FLAG;
+    }
+    else {
+        flags[way] &= ~DIRTY_FLAG;
+    }
+}
+
+/****************************************************************************************
+ * Function Name:       SetValidBit
+ * Input Parameters:    int index - represents the cache row index to change
+ *                      int newBit - represents the value that valid bit will be set to
+ * Return Value:        void
+ * Purpose:             Sets the valid bit value to newBit value at the given index
+ ***************************************************************************************/
+inline void CacheTable::SetValidBit(int index, bool newBit) {
+    // Set the valid byte at index equal to the bool newBit
+    int way;
+    unsigned char* block = GetSetBlock(index, way);
+    block[validOffset + way] = newBit;
+}
+
+/****************************************************************************************
+ * Function Name:       SetTag
+ * Input Parameters:    int index - represents the cache row index to change
+ *                      unsigned long long newTag - represents the packed tag bits of
+ *                      the main memory address
+ * Return Value:        void
+ * Purpose:             Stores the packed tag at the given cache row index and marks
+ *                      the line as used. The tag is only converted into a string of 
+ *                      1's and 0's, and the data into "mm blk # N", when printed.
+ ***************************************************************************************/
+inline void CacheTable::SetTag(int index, unsigned long long newTag) {
+    // Set packed tag at index equal to newTag in the set's tags
+    int way;
+    unsigned char* block = GetSetBlock(index, way);
+    if(isWideTag) {
+        ((unsigned long long*)block)[way] = newTag;
+    }
+    else {
+        ((unsigned int*)block)[way] = (unsigned int)newTag;
+    }
+
+    // Line now holds a block
+    block[flagsOffset + way] |= USED_FLAG;
+}
+
+#endif
\ No newline at end of file
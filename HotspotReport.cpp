@@ -0,0 +1,222 @@
+/****************************************************************************************
+ *  Memory Simulator: "HotspotReport.cpp"
+ *
+ *  Author:     Hannah Perkins
+ *  CWID:       11472559
+ *  Assignment: Lab #7
+ *
+ *  Date:       17 October 2026
+ *  Course:     ECE 487
+ *
+ *  Function:   Reports how memory accesses are spread over the cache sets
+ *
+ *  Description: Hotspot Report Class that reads the per-set counters kept by the
+ *          Cache Engine (accesses, hits, misses, evictions, and dirty evictions of
+ *          every set) after a simulation and prints:
+ *
+ *              - a distribution summary of accesses and evictions per set (min,
+ *                median, mean, max, standard deviation, and the share of accesses
+ *                that go to the hottest tenth of the sets)
+ *              - the K sets with the most accesses (hottest)
+ *              - the K sets with the most evictions (most conflicted)
+ *
+ *          An even spread has a coefficient of variation (std dev / mean) near 0
+ *          and the hottest tenth of the sets holding about 10% of the accesses. An
+ *          indexing scheme that concentrates traffic on a few sets shows up as a
+ *          large coefficient and a few sets with most of the evictions.
+ *
+ ***************************************************************************************/
+
+#ifndef HOTSPOTREPORT_CPP
+#define HOTSPOTREPORT_CPP
+
+#include "CacheEngine.h"
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <math.h>
+using namespace std;
+
+/****************************************************************************************
+ * Class Name:          HotspotReport
+ * Purpose:             Summarizes the per-set counters of a Cache Engine and prints
+ *                      the hottest and most conflicted sets
+ ***************************************************************************************/
+class HotspotReport {
+    public:
+        HotspotReport();                            // Constructor
+
+        // User Functions
+        void Collect(CacheEngine &engine);
+        void Print(int topSets);
+
+    private:
+        // Variables Calculated and Set by Program
+        vector<SetCounters> sets;
+
+        // Helper Functions
+        void PrintDistribution(string label, vector<long long> values);
+        void PrintTopSets(string title, vector<int> &order, int topSets);
+        void PrintRow(int set);
+};
+
+/****************************************************************************************
+ * Constructor
+ ***************************************************************************************/
+HotspotReport::HotspotReport() {
+    // Nothing collected yet
+    sets.clear();
+}
+
+/****************************************************************************************
+ * Function Name:       Collect
+ * Input Parameters:    CacheEngine& - represents the engine after a simulation
+ * Return Value:        void
+ * Purpose:             Copies the counters of every cache set
+ ***************************************************************************************/
+void HotspotReport::Collect(CacheEngine &engine) {
+    // Copy Set by Set
+    sets.resize(engine.GetCacheSets());
+    for(int i=0; i < (int)sets.size(); i++) {
+        sets[i] = engine.GetSetCounters(i);
+    }
+}
+
+/****************************************************************************************
+ * Function Name:       Print
+ * Input Parameters:    int - represents how many of the hottest and most conflicted
+ *                      sets to list
+ * Return Value:        void
+ * Purpose:             Prints the distribution summary, then the hottest sets (most
+ *                      accesses) and the most conflicted sets (most evictions)
+ ***************************************************************************************/
+void HotspotReport::Print(int topSets) {
+    // Count used sets and total accesses
+    long long totalAccesses = 0;
+    int usedSets = 0;
+    vector<long long> accesses(sets.size());
+    vector<long long> evictions(sets.size());
+    for(int i=0; i < (int)sets.size(); i++) {
+        accesses[i] = sets[i].accesses;
+        evictions[i] = sets[i].evictions;
+        totalAccesses += sets[i].accesses;
+        if(sets[i].accesses > 0) {
+            usedSets++;
+        }
+    }
+
+    // Print Distribution Summary
+    cout << endl << "Per-set statistics: " << usedSets << " of " << sets.size();
+    cout << " sets accessed" << endl;
+    PrintDistribution("Accesses per set", accesses);
+    PrintDistribution("Evictions per set", evictions);
+
+    // Sets ordered from most to fewest accesses (Ties in set order)
+    vector<int> order(sets.size());
+    for(int i=0; i < (int)order.size(); i++) {
+        order[i] = i;
+    }
+    stable_sort(order.begin(), order.end(), [this](int a, int b) {
+        return sets[a].accesses > sets[b].accesses;
+    });
+
+    // Share of accesses in the hottest tenth of the sets (At least one set)
+    int tenth = max((int)sets.size() / 10, 1);
+    long long tenthAccesses = 0;
+    for(int i=0; i < tenth; i++) {
+        tenthAccesses += sets[order[i]].accesses;
+    }
+    double tenthShare = 0;
+    if(totalAccesses > 0) {
+        tenthShare = 100.0 * ((double)tenthAccesses / (double)totalAccesses);
+    }
+    cout << "Hottest " << tenth << " sets (10%) hold " << tenthShare << "% of accesses" << endl;
+
+    // Print Hottest Sets
+    PrintTopSets("Hottest sets (most accesses):", order, topSets);
+
+    // Sets ordered from most to fewest evictions, then most misses
+    stable_sort(order.begin(), order.end(), [this](int a, int b) {
+        if(sets[a].evictions != sets[b].evictions) {
+            return sets[a].evictions > sets[b].evictions;
+        }
+        return (sets[a].accesses - sets[a].hits) > (sets[b].accesses - sets[b].hits);
+    });
+
+    // Print Most Conflicted Sets
+    PrintTopSets("Most conflicted sets (most evictions):", order, topSets);
+}
+
+/****************************************************************************************
+ * Function Name:       PrintDistribution
+ * Input Parameters:    string label - represents the name of the counter
+ *                      vector<long long> values - represents the counter of each set
+ * Return Value:        void
+ * Purpose:             Prints the min, median, mean, max, standard deviation, and
+ *                      coefficient of variation of a per-set counter
+ ***************************************************************************************/
+void HotspotReport::PrintDistribution(string label, vector<long long> values) {
+    // No sets, nothing to print
+    if(values.size() == 0) {
+        return;
+    }
+
+    // Mean
+    double sum = 0;
+    for(int i=0; i < (int)values.size(); i++) {
+        sum += values[i];
+    }
+    double mean = sum / values.size();
+
+    // Standard Deviation
+    double squares = 0;
+    for(int i=0; i < (int)values.size(); i++) {
+        squares += (values[i] - mean) * (values[i] - mean);
+    }
+    double deviation = sqrt(squares / values.size());
+
+    // Min, Median, and Max (values is a copy, so it can be sorted)
+    sort(values.begin(), values.end());
+
+    // Print Summary (Coefficient of variation is 0 when nothing was counted)
+    cout << label << ": min " << values.front() << ", median " << values[values.size() / 2];
+    cout << ", mean " << mean << ", max " << values.back() << ", std dev " << deviation;
+    cout << ", CV " << ((mean > 0) ? (deviation / mean) : 0) << endl;
+}
+
+/****************************************************************************************
+ * Function Name:       PrintTopSets
+ * Input Parameters:    string title - represents the title of the list
+ *                      vector<int> &order - represents the sets, most important first
+ *                      int topSets - represents how many sets to list
+ * Return Value:        void
+ * Purpose:             Prints the column headers and the first topSets sets of order
+ ***************************************************************************************/
+void HotspotReport::PrintTopSets(string title, vector<int> &order, int topSets) {
+    // Print Title and Column Headers
+    cout << endl << title << endl;
+    cout << "cm set #" << "\t" << "accesses" << "\t" << "hits" << "\t\t" << "misses";
+    cout << "\t\t" << "evictions" << "\t" << "dirty evictions" << endl;
+    cout << "----------------------------------------------------------------------";
+    cout << "--------------" << endl;
+
+    // Print Rows (No more than there are sets)
+    for(int i=0; i < min(topSets, (int)order.size()); i++) {
+        PrintRow(order[i]);
+    }
+}
+
+/****************************************************************************************
+ * Function Name:       PrintRow
+ * Input Parameters:    int - represents the cache memory set number
+ * Return Value:        void
+ * Purpose:             Prints a single set's counters
+ ***************************************************************************************/
+void HotspotReport::PrintRow(int set) {
+    // Print Set Number and Counters
+    cout << set << "\t\t" << sets[set].accesses << "\t\t" << sets[set].hits << "\t\t";
+    cout << (sets[set].accesses - sets[set].hits) << "\t\t" << sets[set].evictions;
+    cout << "\t\t" << sets[set].dirtyEvictions << endl;
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,274 @@
+/****************************************************************************************
+ *  Memory Simulator: "IntervalStats.cpp"
+ *
+ *  Author:     Hannah Perkins
+ *  CWID:       11472559
+ *  Assignment: Lab #7
+ *
+ *  Date:       17 October 2026
+ *  Course:     ECE 487
+ *
+ *  Function:   Reports cache behavior over fixed windows of the trace and detects
+ *          program phases
+ *
+ *  Description: Interval Statistics Class that is handed the result of every memory
+ *          access while a trace runs. Every N accesses (a window) it prints one line
+ *          with the window's hit rate, miss rate, writebacks (dirty blocks replaced),
+ *          and the number of unique main memory blocks touched, so long runs show
+ *          their progress as they go.
+ *
+ *              A phase is a run of windows with similar behavior. Each window is
+ *          compared with the average of the windows in the current phase, and a new
+ *          phase begins when the miss rate moves by more than PHASE_MISS_CHANGE
+ *          (percentage points) or the unique blocks touched grow or shrink by more
+ *          than PHASE_BLOCK_RATIO times. After the trace, every phase is listed with
+ *          its windows and miss rate, which points out the phases that hurt the
+ *          cache.
+ *
+ *          Example window line:
+ *
+ *              window 3 (accesses 2000 - 2999): hit rate 45.2%, miss rate 54.8%,
+ *              writebacks 12, unique blocks 340   <- phase 2
+ *
+ ***************************************************************************************/
+
+#ifndef INTERVALSTATS_CPP
+#define INTERVALSTATS_CPP
+
+#include "CacheEngine.h"
+#include "BlockSet.h"
+#include "Address.h"
+#include <iostream>
+#include <vector>
+#include <math.h>
+using namespace std;
+
+// Phase Change Thresholds
+const double PHASE_MISS_CHANGE = 10.0;      // Miss rate change, in percentage points
+const double PHASE_BLOCK_RATIO = 2.0;       // Unique blocks change, as a ratio
+
+/****************************************************************************************
+ * Struct Name:         IntervalPhase
+ * Purpose:             Holds the windows of one program phase and their totals
+ ***************************************************************************************/
+struct IntervalPhase {
+    long long firstWindow;
+    long long windows;
+    long long accesses;
+    long long misses;
+    long long writebacks;
+    long long uniqueBlocks;             // Sum over the phase's windows
+};
+
+/****************************************************************************************
+ * Class Name:          IntervalStats
+ * Purpose:             Prints hit rate, miss rate, writebacks, and unique blocks of
+ *                      every window of accesses and detects phase changes
+ ***************************************************************************************/
+class IntervalStats {
+    public:
+        IntervalStats();                            // Constructor
+
+        // User Functions
+        void SetIntervals(long long windowSize, int blockSize);
+        void Access(Address address, const AccessResult &result);
+        void Finish();
+
+        // Getter Functions
+        bool GetIsEnabled();
+
+    private:
+        // Variables Set by User
+        long long windowSize;               // 0 = no interval statistics
+        int blockSize;
+
+        // Current Window
+        long long window;
+        long long accesses;
+        long long misses;
+        long long writebacks;
+        long long uniqueBlocks;
+
+        // Blocks touched in the current window (Emptied when the window ends)
+        BlockSet windowBlocks;
+
+        // Phases found so far (The last one is the current phase)
+        vector<IntervalPhase> phases;
+
+        // Helper Functions
+        void EndWindow();
+        bool IsPhaseChange();
+};
+
+/****************************************************************************************
+ * Constructor
+ ***************************************************************************************/
+IntervalStats::IntervalStats() {
+    // Disabled until a window size is set
+    windowSize = 0;
+    blockSize = 1;
+    window = 0;
+    accesses = 0;
+    misses = 0;
+    writebacks = 0;
+    uniqueBlocks = 0;
+}
+
+/****************************************************************************************
+ * Function Name:       SetIntervals
+ * Input Parameters:    long long windowSize - represents the accesses per window
+ *                      (0 = no interval statistics)
+ *                      int blockSize - represents the cache block size
+ * Return Value:        void
+ * Purpose:             Starts the first window and clears any earlier phases
+ ***************************************************************************************/
+void IntervalStats::SetIntervals(long long windowSize, int blockSize) {
+    // Set Variables
+    this->windowSize = windowSize;
+    this->blockSize = blockSize;
+
+    // Start the first window
+    window = 0;
+    accesses = 0;
+    misses = 0;
+    writebacks = 0;
+    uniqueBlocks = 0;
+    windowBlocks.Clear();
+    phases.clear();
+}
+
+/****************************************************************************************
+ * Function Name:       Access
+ * Input Parameters:    Address address - represents the main memory address accessed
+ *                      const AccessResult &result - represents what the access did
+ * Return Value:        void
+ * Purpose:             Counts the access in the current window and prints the window
+ *                      once it holds windowSize accesses
+ ***************************************************************************************/
+void IntervalStats::Access(Address address, const AccessResult &result) {
+    // Count Access, Miss, and Writeback
+    accesses++;
+    if(!result.hit) {
+        misses++;
+    }
+    if(result.evicted && result.evictedDirty) {
+        writebacks++;
+    }
+
+    // Count the block the first time this window touches it
+    if(windowBlocks.Insert(address / blockSize)) {
+        uniqueBlocks++;
+    }
+
+    // Window is full
+    if(accesses == windowSize) {
+        EndWindow();
+    }
+}
+
+/****************************************************************************************
+ * Function Name:       Finish
+ * Input Parameters:    void
+ * Return Value:        void
+ * Purpose:             Prints the last partial window and the list of phases
+ ***************************************************************************************/
+void IntervalStats::Finish() {
+    // Print the accesses left in a partial window
+    if(accesses > 0) {
+        EndWindow();
+    }
+
+    // Nothing to summarize
+    if(phases.size() == 0) {
+        return;
+    }
+
+    // Print every Phase
+    cout << endl << "Phases (" << phases.size() << " found):" << endl;
+    for(int i=0; i < (int)phases.size(); i++) {
+        IntervalPhase &phase = phases[i];
+        cout << "phase " << (i + 1) << ": windows " << phase.firstWindow << " - ";
+        cout << (phase.firstWindow + phase.windows - 1) << ", " << phase.accesses;
+        cout << " accesses, miss rate " << 100.0 * phase.misses / phase.accesses << "%";
+        cout << ", writebacks " << phase.writebacks << ", unique blocks per window ";
+        cout << (double)phase.uniqueBlocks / phase.windows << endl;
+    }
+}
+
+/****************************************************************************************
+ * Function Name:       GetIsEnabled
+ * Input Parameters:    void
+ * Return Value:        bool - represents whether a window size was set
+ * Purpose:             Lets callers skip the interval work when it is not needed
+ ***************************************************************************************/
+bool IntervalStats::GetIsEnabled() {
+    // Windows of 0 accesses mean disabled
+    return windowSize > 0;
+}
+
+/****************************************************************************************
+ * Function Name:       EndWindow
+ * Input Parameters:    void
+ * Return Value:        void
+ * Purpose:             Prints the current window, adds it to the current phase or
+ *                      starts a new phase, then starts the next window
+ ***************************************************************************************/
+void IntervalStats::EndWindow() {
+    // Window's Rates
+    double missRate = 100.0 * misses / accesses;
+
+    // Print Window (Ends the line at once so long runs show progress)
+    long long firstAccess = window * windowSize;
+    cout << "window " << window << " (accesses " << firstAccess << " - ";
+    cout << (firstAccess + accesses - 1) << "): hit rate " << (100.0 - missRate);
+    cout << "%, miss rate " << missRate << "%, writebacks " << writebacks;
+    cout << ", unique blocks " << uniqueBlocks;
+
+    // Start a new Phase or extend the current one (A partial last window is too
+    // short to compare)
+    if((phases.size() == 0) || ((accesses == windowSize) && IsPhaseChange())) {
+        IntervalPhase phase = { window, 0, 0, 0, 0, 0 };
+        phases.push_back(phase);
+        cout << "   <- phase " << phases.size();
+    }
+    IntervalPhase &phase = phases.back();
+    phase.windows++;
+    phase.accesses += accesses;
+    phase.misses += misses;
+    phase.writebacks += writebacks;
+    phase.uniqueBlocks += uniqueBlocks;
+    cout << endl;
+
+    // Start the next Window
+    window++;
+    accesses = 0;
+    misses = 0;
+    writebacks = 0;
+    uniqueBlocks = 0;
+    windowBlocks.Clear();
+}
+
+/****************************************************************************************
+ * Function Name:       IsPhaseChange
+ * Input Parameters:    void
+ * Return Value:        bool - represents whether the current window starts a new phase
+ * Purpose:             Compares the window's miss rate and unique blocks with the
+ *                      average of the windows in the current phase
+ ***************************************************************************************/
+bool IntervalStats::IsPhaseChange() {
+    // Averages of the Current Phase
+    IntervalPhase &phase = phases.back();
+    double phaseMissRate = 100.0 * phase.misses / phase.accesses;
+    double phaseBlocks = (double)phase.uniqueBlocks / phase.windows;
+
+    // Miss Rate moved too far
+    if(fabs((100.0 * misses / accesses) - phaseMissRate) > PHASE_MISS_CHANGE) {
+        return true;
+    }
+
+    // Working Set grew or shrank too much
+    double blocks = (double)uniqueBlocks;
+    return (blocks > phaseBlocks * PHASE_BLOCK_RATIO) || (blocks * PHASE_BLOCK_RATIO < phaseBlocks);
+}
+
+#endif
\ No newline at end of file
@@ -21,11 +21,27 @@
  *          The Cache Table represents how the cache memory would look to a user after
  *          their sequence of memory accesses is complete.
  * 
- *              Upon startup, the program will create an instance of the MemorySim 
- *          class and perform a list of necessary lab 7 functions under one test
- *          function called RunAll(). After running the memory simulation, the program
- *          prompts the user if they would like to continue with an additional 
- *          simulation. 
+ *              Upon startup, the program asks which simulation mode to use, then 
+ *          creates an instance of the MemorySim class. In address table mode it
+ *          performs a list of necessary lab 7 functions under one test function 
+ *          called RunAll(). Parallel address table mode also calls RunAll(), but
+ *          splits the cache sets among all cores. In streaming mode it calls RunStreaming(), which 
+ *          simulates the trace while reading it. In sweep mode it calls 
+ *          RunSweep(), which runs a list of cache configurations in one pass. In
+ *          miss ratio curve mode it calls RunMissRatioCurve(), which finds the LRU
+ *          miss ratio of every cache size in one pass. In hierarchy mode it calls 
+ *          RunHierarchy(), which runs the trace through L1, L2, L3, ... caches. 
+ *          After running the memory simulation, the program prompts the user if 
+ *          they would like to continue with an additional simulation. 
+ * 
+ *              The cache model itself (CacheEngine and the CacheTable, replacement
+ *          policies, BlockSet, BlockMap, and WriteBuffer it uses) is built
+ *          separately as the cachesim library, and this program is linked against
+ *          it (see "CMakeLists.txt").
+ * 
+ *              When started with command-line flags, the program instead runs the
+ *          configurations they describe through the BatchRunner, writes a CSV 
+ *          summary, and exits without reading stdin (see "BatchRunner.cpp").
  * 
  *          NOTE: No error handling. Program assumes user always enters correct/valid
  *          input.
@@ -33,7 +49,9 @@
  ***************************************************************************************/
 
 #include "MemorySim.cpp"
+#include "BatchRunner.cpp"
 #include <iostream>
+#include <thread>
 using namespace std;
 
 /****************************************************************************************
@@ -58,23 +76,86 @@ char ContinuePrompt() {
     return input;
 }
 
+/****************************************************************************************
+ * Function Name:       ModePrompt
+ * Input Parameters:    void
+ * Return Value:        char - represents the user's choice of 'T' = address table,
+ *                      'P' = parallel address table, 'S' = streaming, 'W' = sweep,
+ *                      'M' = miss ratio curve, or 'H' = cache hierarchy
+ * Purpose:             Prompts the user for the simulation mode. Address table mode
+ *                      stores and prints every memory access; parallel address 
+ *                      table mode gives the same output using every core. 
+ *                      Streaming mode simulates accesses as they are read and uses
+ *                      constant memory.
+ *                      Sweep mode simulates many cache configurations in one pass.
+ *                      Miss ratio curve mode finds LRU miss ratios of all cache sizes.
+ *                      Hierarchy mode simulates several levels of cache.
+ ***************************************************************************************/
+char ModePrompt() {
+    // Declare temporary char variable
+    char input;
+
+    // Prompt User for Simulation Mode
+    cout << "Enter the simulation mode (T = address table, P = parallel address table, ";
+    cout << "S = streaming, W = sweep, M = miss ratio curve, H = cache hierarchy): ";
+    cin >> input;
+
+    // Return user's response
+    return input;
+}
+
 /*******************************************************************************
  * --------------------- MAIN -------------------------------------------------
  ******************************************************************************/
-int main() {
+int main(int argc, char* argv[]) {
+    // Command-line flags: run the batch and exit, never prompting
+    if(argc > 1) {
+        BatchRunner batch;
+        return batch.Run(argc, argv);
+    }
+
     // Variable for whether user wants to continue or exit program
     char userInput;
 
+    // Variable for the user's chosen simulation mode
+    char mode;
+
     // Runs Memory Simulator once and checks after each simulation if
     // user wants to continue and run additional simulations.
     do {
         // Create an instance of MemorySim Class called MyMemory
         MemorySim MyMemory;
 
-        // Consider Putting everything into a RunAll() function
-        MyMemory.RunAll();
+        // Prompt User for Simulation Mode
+        mode = ModePrompt();
+
+        // Streaming Mode: simulate while reading the file
+        if(mode == 'S') {
+            MyMemory.RunStreaming();
+        }
+        // Sweep Mode: simulate a list of configurations in one pass
+        else if(mode == 'W') {
+            MyMemory.RunSweep();
+        }
+        // Miss Ratio Curve Mode: LRU miss ratio of every cache size in one pass
+        else if(mode == 'M') {
+            MyMemory.RunMissRatioCurve();
+        }
+        // Hierarchy Mode: L1, L2, L3, ... caches above main memory
+        else if(mode == 'H') {
+            MyMemory.RunHierarchy();
+        }
+        // Parallel Address Table Mode: split cache sets among all cores
+        else if(mode == 'P') {
+            MyMemory.SetThreads(thread::hardware_concurrency());
+            MyMemory.RunAll();
+        }
+        // Address Table Mode: Consider Putting everything into a RunAll() function
+        else {
+            MyMemory.RunAll();
+        }
 
         // Prompt User to continue or not
         userInput = ContinuePrompt();
     } while(userInput == 'y');
-}
+}
\ No newline at end of file
@@ -0,0 +1,766 @@
+/****************************************************************************************
+ *  Memory Simulator: "MemoryBench.cpp"
+ *
+ *  Author:     Hannah Perkins
+ *  CWID:       11472559
+ *  Assignment: Lab #7
+ *
+ *  Date:       17 October 2026
+ *  Course:     ECE 487
+ *
+ *  Function:   Measures the throughput of the simulator
+ *
+ *  Description:    Stand-alone benchmark program, built by the "memorybench" target
+ *          and run by the "bench" target (see "CMakeLists.txt"). It writes seeded
+ *          text traces, then measures:
+ *
+ *              parse       MB/s of the ReadFile path (Trace Reader into the
+ *                          Address Table), for every trace size
+ *              assoc       accesses/s of the RunMemorySequence path (Cache Engine
+ *                          and Miss Classifier, sharded over --threads threads)
+ *                          from direct mapped to fully associative
+ *              block       accesses/s across block sizes
+ *              policy      accesses/s of every replacement policy
+ *              size        accesses/s for every trace size
+ *              gen-*       accesses/s of each synthetic workload generated in
+ *                          memory and streamed through the Cache Engine and Miss
+ *                          Classifier (see "TraceGenerator.cpp")
+ *              probe-*     probes/s of the set search alone (tag match, empty
+ *                          way, and LRU victim) for 16- to 64-way sets, once with
+ *                          the scalar loop (probe-scalar) and once with the vector
+ *                          version this CPU runs (probe-avx2 or probe-sse2), so
+ *                          the two rows of each associativity give the speedup
+ *                          (see "WayProbe.h")
+ *
+ *          Every measurement is the fastest of several repeats. The traces are
+ *          the same on every run, so the cases, their order, and their hit rates
+ *          only change when the simulator does; diffing two outputs shows the
+ *          throughput change between versions.
+ *
+ *          Usage: memorybench [--format csv|json] [--output <file>]
+ *                             [--accesses <n>] [--repeat <n>] [--dir <directory>]
+ *                             [--threads <n>]
+ *
+ ***************************************************************************************/
+
+#include "MemorySim.cpp"
+#include "AddressTable.cpp"
+#include "CacheEngine.h"
+#include "MissClassifier.cpp"
+#include "TraceReader.cpp"
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+using namespace std;
+
+// Benchmark Cache (8 KB of 32-byte blocks in a 1 MB main memory)
+const int BENCH_MEMORY_SIZE = 1048576;
+const int BENCH_CACHE_SIZE = 8192;
+const int BENCH_BLOCK_SIZE = 32;
+const int BENCH_ASSOCIATIVITY = 4;
+
+// Seed of the benchmark traces
+const unsigned int BENCH_SEED = 12345u;
+
+// Sets of the probe benchmark (64-way sets keep the tags in a 256 KB table)
+const int BENCH_PROBE_SETS = 1024;
+
+/****************************************************************************************
+ * Struct Name:         BenchCase
+ * Purpose:             Holds the settings of one measurement
+ ***************************************************************************************/
+struct BenchCase {
+    string group;
+    int accesses;
+    int cacheSize;
+    int blockSize;
+    int mappingAssociation;
+    int replacementPolicy;
+};
+
+/****************************************************************************************
+ * Class Name:          MemoryBench
+ * Purpose:             Writes the benchmark traces, runs every measurement, and writes
+ *                      the results as CSV or JSON
+ ***************************************************************************************/
+class MemoryBench {
+    public:
+        MemoryBench();                              // Constructor
+
+        // User Functions
+        int Run(int argc, char* argv[]);
+        void PrintUsage();
+
+    private:
+        // Variables Set by User
+        bool json;
+        string outputFileName;
+        int maxAccesses;
+        int repeats;
+        string directory;
+        int threads;
+
+        // Variables Calculated and Set by Program
+        vector<int> traceSizes;
+        int rows;
+
+        // Helper Functions
+        bool ParseFlags(int argc, char* argv[]);
+        string WriteTrace(int accesses);
+        double RunParse(string fileName, AddressTable &table, long long &bytes);
+        double RunSequence(BenchCase &benchCase, AddressTable &loadedTable, double &hitRate);
+        double RunGenerated(BenchCase &benchCase, string spec, double &hitRate);
+        double RunProbe(BenchCase &benchCase, bool useVector, double &hitRate,
+                long long &checksum);
+        void RunCases(vector<BenchCase> &cases, AddressTable &table, ostream &output);
+        void PrintHeader(ostream &output);
+        void PrintRow(ostream &output, BenchCase &benchCase, double seconds, double rate,
+                string unit, double hitRate);
+        void PrintFooter(ostream &output);
+};
+
+/****************************************************************************************
+ * Constructor
+ ***************************************************************************************/
+MemoryBench::MemoryBench() {
+    // CSV to stdout, 1,000,000 accesses, best of 3, traces in the current directory,
+    // memory sequence on a single thread
+    json = false;
+    outputFileName = "";
+    maxAccesses = 1000000;
+    repeats = 3;
+    directory = ".";
+    threads = 1;
+
+    // Nothing written yet
+    rows = 0;
+}
+
+/****************************************************************************************
+ * Function Name:       Run
+ * Input Parameters:    int argc - represents the number of command-line arguments
+ *                      char* argv[] - represents the command-line arguments
+ * Return Value:        int - represents the exit code (0 = done, 1 = a trace could
+ *                      not be written, 2 = bad arguments, 3 = the vector set probe
+ *                      disagreed with the scalar loop)
+ * Purpose:             Writes the traces and runs the parse measurements on each one,
+ *                      then runs the sequence measurements on the largest trace
+ ***************************************************************************************/
+int MemoryBench::Run(int argc, char* argv[]) {
+    // Read Flags
+    if(!ParseFlags(argc, argv)) {
+        return 2;
+    }
+
+    // Trace Sizes (1%, 10%, and 100% of the largest)
+    traceSizes.clear();
+    if(maxAccesses >= 10000) {
+        traceSizes.push_back(maxAccesses / 100);
+        traceSizes.push_back(maxAccesses / 10);
+    }
+    traceSizes.push_back(maxAccesses);
+
+    // Open Output (stdout unless a file was given)
+    ofstream outputFile;
+    if(outputFileName.length() > 0) {
+        outputFile.open(outputFileName);
+        if(!outputFile.is_open()) {
+            cerr << "Unable to open output file: " << outputFileName << endl;
+            return 2;
+        }
+    }
+    ostream &output = (outputFileName.length() > 0) ? outputFile : cout;
+    PrintHeader(output);
+
+    // Address Table of the largest trace (Every other case runs on it)
+    AddressTable largestTable;
+
+    // Parse each Trace Size
+    for(int i=0; i < (int)traceSizes.size(); i++) {
+        // Write the Trace
+        string fileName = WriteTrace(traceSizes[i]);
+        if(fileName.length() == 0) {
+            cerr << "Unable to write trace in: " << directory << endl;
+            return 1;
+        }
+
+        // Parse it into an Address Table
+        AddressTable table;
+        long long bytes = 0;
+        double seconds = RunParse(fileName, table, bytes);
+        remove(fileName.c_str());
+
+        // Write the Parse Row
+        BenchCase parseCase = { "parse", traceSizes[i], 0, 0, 0, 0 };
+        double megabytes = (double)bytes / 1000000.0;
+        PrintRow(output, parseCase, seconds, megabytes / max(seconds, 1e-9), "MB/s", 0);
+
+        // Sequence Case for this size
+        BenchCase sizeCase = { "size", traceSizes[i], BENCH_CACHE_SIZE, BENCH_BLOCK_SIZE,
+                BENCH_ASSOCIATIVITY, LRU_POLICY };
+        vector<BenchCase> sizeCases(1, sizeCase);
+        RunCases(sizeCases, table, output);
+
+        // Keep the largest trace
+        if(traceSizes[i] == maxAccesses) {
+            largestTable = table;
+        }
+    }
+
+    // Associativity Cases (Direct mapped up to fully associative)
+    vector<BenchCase> cases;
+    for(int ways = 1; ways <= (BENCH_CACHE_SIZE / BENCH_BLOCK_SIZE); ways *= 2) {
+        BenchCase assocCase = { "assoc", maxAccesses, BENCH_CACHE_SIZE, BENCH_BLOCK_SIZE,
+                ways, LRU_POLICY };
+        cases.push_back(assocCase);
+    }
+    RunCases(cases, largestTable, output);
+
+    // Block Size Cases
+    cases.clear();
+    for(int block = 16; block <= 256; block *= 2) {
+        BenchCase blockCase = { "block", maxAccesses, BENCH_CACHE_SIZE, block,
+                BENCH_ASSOCIATIVITY, LRU_POLICY };
+        cases.push_back(blockCase);
+    }
+    RunCases(cases, largestTable, output);
+
+    // Replacement Policy Cases
+    cases.clear();
+    int policies[8] = { LRU_POLICY, FIFO_POLICY, OPT_POLICY, PLRU_POLICY, SRRIP_POLICY,
+            BRRIP_POLICY, RANDOM_POLICY, LFU_POLICY };
+    for(int i=0; i < 8; i++) {
+        BenchCase policyCase = { "policy", maxAccesses, BENCH_CACHE_SIZE, BENCH_BLOCK_SIZE,
+                BENCH_ASSOCIATIVITY, policies[i] };
+        cases.push_back(policyCase);
+    }
+    RunCases(cases, largestTable, output);
+
+    // Generated Workload Cases (Footprint four times the cache, a quarter written)
+    string patterns[6] = { "sequential", "strided", "uniform", "zipf", "chase", "mixed" };
+    for(int i=0; i < 6; i++) {
+        BenchCase generatedCase = { "gen-" + patterns[i], maxAccesses, BENCH_CACHE_SIZE,
+                BENCH_BLOCK_SIZE, BENCH_ASSOCIATIVITY, LRU_POLICY };
+        string spec = GENERATOR_PREFIX + patterns[i] + ",accesses=" + to_string(maxAccesses) +
+                ",footprint=" + to_string(4 * BENCH_CACHE_SIZE) + ",writes=25,seed=" +
+                to_string(BENCH_SEED);
+        double hitRate = 0;
+        double seconds = RunGenerated(generatedCase, spec, hitRate);
+        PrintRow(output, generatedCase, seconds, maxAccesses / max(seconds, 1e-9),
+                "accesses/s", hitRate);
+    }
+
+    // Set Probe Cases (Scalar loop, then the vector version, for each associativity)
+    bool probesAgree = true;
+    for(int ways = 16; ways <= 64; ways *= 2) {
+        long long checksums[2] = { 0, 0 };
+        for(int v=0; v < 2; v++) {
+            string group = "probe-" + ((v == 0) ? string("scalar") : GetProbeInstructionSet());
+            BenchCase probeCase = { group, maxAccesses, BENCH_PROBE_SETS * ways * BENCH_BLOCK_SIZE,
+                    BENCH_BLOCK_SIZE, ways, LRU_POLICY };
+            double hitRate = 0;
+            double seconds = RunProbe(probeCase, v == 1, hitRate, checksums[v]);
+            PrintRow(output, probeCase, seconds, maxAccesses / max(seconds, 1e-9),
+                    "probes/s", hitRate);
+        }
+
+        // Both versions must pick the same ways
+        if(checksums[0] != checksums[1]) {
+            cerr << "Vector set probe disagrees with the scalar loop at " << ways;
+            cerr << " ways" << endl;
+            probesAgree = false;
+        }
+    }
+
+    PrintFooter(output);
+
+    // Fail the run if the vector set probe picked different ways
+    if(!probesAgree) {
+        return 3;
+    }
+    return 0;
+}
+
+/****************************************************************************************
+ * Function Name:       PrintUsage
+ * Input Parameters:    void
+ * Return Value:        void
+ * Purpose:             Prints the flags the benchmark accepts
+ ***************************************************************************************/
+void MemoryBench::PrintUsage() {
+    // Print Flags
+    cout << "Usage: memorybench [flags]" << endl;
+    cout << "  --format <csv|json> output format (default csv)" << endl;
+    cout << "  --output <file>     results file (default stdout)" << endl;
+    cout << "  --accesses <n>      accesses in the largest trace (default 1000000)" << endl;
+    cout << "  --repeat <n>        runs of each case, fastest is kept (default 3)" << endl;
+    cout << "  --dir <directory>   where the traces are written (default .)" << endl;
+    cout << "  --threads <n>       threads the memory sequence is sharded over (default 1)" << endl;
+    cout << "  --help              print this message" << endl;
+}
+
+/****************************************************************************************
+ * Function Name:       ParseFlags
+ * Input Parameters:    int argc - represents the number of command-line arguments
+ *                      char* argv[] - represents the command-line arguments
+ * Return Value:        bool - represents whether every flag was understood
+ * Purpose:             Applies each "--flag value" pair to the benchmark settings
+ ***************************************************************************************/
+bool MemoryBench::ParseFlags(int argc, char* argv[]) {
+    // Read Flag by Flag
+    for(int i=1; i < argc; i++) {
+        string flag = argv[i];
+
+        // Print usage if asked
+        if((flag == "--help") || (flag == "-h")) {
+            PrintUsage();
+            exit(0);
+        }
+
+        // Every other flag needs a value
+        if((i + 1) >= argc) {
+            cerr << "Missing value for " << flag << endl;
+            return false;
+        }
+        string value = argv[++i];
+
+        // Apply Flag
+        if(flag == "--format") {
+            json = (value == "json");
+            if(!json && (value != "csv")) {
+                cerr << "Unknown format: " << value << endl;
+                return false;
+            }
+        }
+        else if(flag == "--output") {
+            outputFileName = value;
+        }
+        else if(flag == "--accesses") {
+            maxAccesses = atoi(value.c_str());
+        }
+        else if(flag == "--repeat") {
+            repeats = atoi(value.c_str());
+        }
+        else if(flag == "--dir") {
+            directory = value;
+        }
+        else if(flag == "--threads") {
+            threads = atoi(value.c_str());
+        }
+        else {
+            cerr << "Unknown flag: " << flag << endl;
+            return false;
+        }
+    }
+
+    // At least one access, one run, and one thread
+    if((maxAccesses < 1) || (repeats < 1) || (threads < 1)) {
+        cerr << "--accesses, --repeat, and --threads must be at least 1" << endl;
+        return false;
+    }
+
+    return true;
+}
+
+/****************************************************************************************
+ * Function Name:       WriteTrace
+ * Input Parameters:    int - represents the number of accesses to write
+ * Return Value:        string - represents the trace file name ("" if not written)
+ * Purpose:             Writes a seeded text trace. Three of every four accesses go
+ *                      to a region twice the size of the cache, the rest anywhere in
+ *                      main memory, and three of every ten are writes, so every
+ *                      policy sees a mix of hits and misses.
+ ***************************************************************************************/
+string MemoryBench::WriteTrace(int accesses) {
+    // Trace File Name
+    string fileName = directory + "/memorybench_" + to_string(accesses) + ".txt";
+
+    // Open File
+    FILE* file = fopen(fileName.c_str(), "w");
+    if(file == NULL) {
+        return "";
+    }
+
+    // Number of accesses on the first line
+    fprintf(file, "%d\n", accesses);
+
+    // One "R <address>" / "W <address>" line per access
+    unsigned int state = BENCH_SEED;
+    for(int i=0; i < accesses; i++) {
+        // Hot region or anywhere
+        int address;
+        if((NextRandom(state) % 4) != 0) {
+            address = NextRandom(state) % (2 * BENCH_CACHE_SIZE);
+        }
+        else {
+            address = NextRandom(state) % BENCH_MEMORY_SIZE;
+        }
+
+        // Read or Write
+        char operation = ((NextRandom(state) % 10) < 3) ? 'W' : 'R';
+        fprintf(file, "%c %d\n", operation, address);
+    }
+
+    fclose(file);
+    return fileName;
+}
+
+/****************************************************************************************
+ * Function Name:       RunParse
+ * Input Parameters:    string fileName - represents the trace to parse
+ *                      AddressTable &table - filled with the trace's accesses
+ *                      long long &bytes - set to the size of the trace file
+ * Return Value:        double - represents the fastest parse time in seconds
+ * Purpose:             Times the ReadFile path: the Trace Reader parses the file and
+ *                      each access is added as a row of an Address Table
+ ***************************************************************************************/
+double MemoryBench::RunParse(string fileName, AddressTable &table, long long &bytes) {
+    // Temporary Variables for each Memory Access
+    bool isWrite;
+    Address address;
+
+    // Fastest of the repeats
+    double best = 0;
+    for(int r=0; r < repeats; r++) {
+        // Fresh Address Table and Trace Reader
+        AddressTable runTable;
+        TraceReader reader;
+
+        // Start timer
+        chrono::steady_clock::time_point startTime = chrono::steady_clock::now();
+
+        // Parse every Access into the Address Table
+        if(!reader.Open(fileName)) {
+            return 0;
+        }
+        runTable.SetSize(reader.GetSize());
+        while(reader.Next(isWrite, address)) {
+            runTable.AddRow(isWrite, address);
+        }
+        bytes = reader.GetFileSize();
+        reader.Close();
+
+        // Keep the fastest
+        chrono::duration<double> elapsed = chrono::steady_clock::now() - startTime;
+        if((r == 0) || (elapsed.count() < best)) {
+            best = elapsed.count();
+        }
+
+        // Keep the last table for the sequence cases
+        if(r == (repeats - 1)) {
+            table = runTable;
+        }
+    }
+
+    return best;
+}
+
+/****************************************************************************************
+ * Function Name:       RunSequence
+ * Input Parameters:    BenchCase &benchCase - represents the cache to simulate
+ *                      AddressTable &loadedTable - represents the parsed trace
+ *                      double &hitRate - set to the hit rate of the case
+ * Return Value:        double - represents the fastest run time in seconds
+ * Purpose:             Times MemorySim::RunMemorySequence itself: every row of the
+ *                      Address Table is accessed through the Cache Engine (sharded
+ *                      over the threads), hits are set on the table, and misses are
+ *                      classified. The cache is set up and next uses are found 
+ *                      before the timer starts, as RunAll does.
+ ***************************************************************************************/
+double MemoryBench::RunSequence(BenchCase &benchCase, AddressTable &loadedTable,
+        double &hitRate) {
+    // Fastest of the repeats
+    double best = 0;
+    for(int r=0; r < repeats; r++) {
+        // Fresh Memory Simulator with a copy of the Address Table (Hits are set on it)
+        MemorySim memorySim;
+        memorySim.SetCache(BENCH_MEMORY_SIZE, benchCase.cacheSize, benchCase.blockSize,
+                benchCase.mappingAssociation, benchCase.replacementPolicy);
+        memorySim.SetThreads(threads);
+        memorySim.SetAddressTable(loadedTable);
+        memorySim.InitializeCacheTable();
+        memorySim.PopulateAddressTable();
+
+        // Start timer
+        chrono::steady_clock::time_point startTime = chrono::steady_clock::now();
+
+        // Perform the memory accesses
+        memorySim.RunMemorySequence();
+
+        // Keep the fastest
+        chrono::duration<double> elapsed = chrono::steady_clock::now() - startTime;
+        if((r == 0) || (elapsed.count() < best)) {
+            best = elapsed.count();
+        }
+
+        // Hit Rate
+        hitRate = memorySim.GetHitRate();
+    }
+
+    return best;
+}
+
+/****************************************************************************************
+ * Function Name:       RunGenerated
+ * Input Parameters:    BenchCase &benchCase - represents the cache to simulate
+ *                      string spec - represents the generator spec of the workload
+ *                      double &hitRate - set to the hit rate of the case
+ * Return Value:        double - represents the fastest run time in seconds
+ * Purpose:             Times the streaming path on a generated workload: every access
+ *                      is generated, simulated, and classified as soon as it is made
+ ***************************************************************************************/
+double MemoryBench::RunGenerated(BenchCase &benchCase, string spec, double &hitRate) {
+    // Chunk of generated Memory Accesses and their results
+    vector<TraceRecord> chunk;
+    vector<AccessResult> results;
+
+    // Fastest of the repeats
+    double best = 0;
+    for(int r=0; r < repeats; r++) {
+        // Fresh Cache Engine, Miss Classifier, and Generator
+        CacheEngine engine;
+        MissClassifier missClassifier;
+        TraceReader reader;
+        engine.SetEngine(BENCH_MEMORY_SIZE, benchCase.cacheSize, benchCase.blockSize,
+                benchCase.mappingAssociation, benchCase.replacementPolicy);
+        engine.SetWritePolicy(true, true, 0);
+        missClassifier.SetClassifier(benchCase.cacheSize, benchCase.blockSize);
+
+        // Start timer (Building the generator's tables is timed too)
+        chrono::steady_clock::time_point startTime = chrono::steady_clock::now();
+
+        // Generate and simulate every Access
+        if(!reader.Open(spec)) {
+            return 0;
+        }
+        while(reader.NextChunk(chunk, ACCESS_CHUNK_SIZE) > 0) {
+            engine.AccessChunk(chunk, results);
+            for(int i=0; i < (int)chunk.size(); i++) {
+                missClassifier.Access(chunk[i].address, results[i].hit);
+            }
+        }
+        engine.FlushWriteBuffer();
+
+        // Keep the fastest
+        chrono::duration<double> elapsed = chrono::steady_clock::now() - startTime;
+        if((r == 0) || (elapsed.count() < best)) {
+            best = elapsed.count();
+        }
+
+        // Hit Rate (Guard against an empty workload)
+        hitRate = 0;
+        if(engine.GetTotalAccesses() > 0) {
+            hitRate = (double)engine.GetTotalHits() / (double)engine.GetTotalAccesses();
+        }
+    }
+
+    return best;
+}
+
+/****************************************************************************************
+ * Function Name:       RunProbe
+ * Input Parameters:    BenchCase &benchCase - represents the associativity to probe
+ *                      bool useVector - represents whether the vector version (1) or
+ *                      the scalar loop (0) is timed
+ *                      double &hitRate - set to the share of probes that hit
+ *                      long long &checksum - set to the sum of the ways found, so the
+ *                      two versions can be compared
+ * Return Value:        double - represents the fastest run time in seconds
+ * Purpose:             Times the set search of the Cache Engine alone. A table of
+ *                      BENCH_PROBE_SETS full sets (one set in eight has an empty way)
+ *                      is probed with seeded tags, half of them present. A miss in a
+ *                      full set also searches the set's time clocks for the LRU
+ *                      victim, as an access would.
+ ***************************************************************************************/
+double MemoryBench::RunProbe(BenchCase &benchCase, bool useVector, double &hitRate,
+        long long &checksum) {
+    // Table of Tags, Valid Bits, and Time Clocks (Ways of a set are contiguous)
+    int ways = benchCase.mappingAssociation;
+    int lines = BENCH_PROBE_SETS * ways;
+    vector<unsigned int> tags(lines);
+    vector<unsigned char> valid(lines, 1);
+    vector<long long> timeClock(lines);
+    unsigned int state = BENCH_SEED;
+    for(int i=0; i < lines; i++) {
+        tags[i] = NextRandom(state) & 0x7FFFFFFF;
+        timeClock[i] = NextRandom(state);
+    }
+    for(int set=0; set < BENCH_PROBE_SETS; set += 8) {
+        valid[(set * ways) + (NextRandom(state) % ways)] = 0;
+    }
+
+    // Seeded Probes: a tag in the set, or one that cannot be (high bit set)
+    vector<int> probeSet(benchCase.accesses);
+    vector<unsigned int> probeTag(benchCase.accesses);
+    for(int i=0; i < benchCase.accesses; i++) {
+        probeSet[i] = NextRandom(state) % BENCH_PROBE_SETS;
+        unsigned int way = NextRandom(state) % ways;
+        probeTag[i] = tags[(probeSet[i] * ways) + way];
+        if((NextRandom(state) % 2) != 0) {
+            probeTag[i] |= 0x80000000u;
+        }
+    }
+
+    // Fastest of the repeats
+    double best = 0;
+    for(int r=0; r < repeats; r++) {
+        long long hits = 0;
+        checksum = 0;
+
+        // Start timer
+        chrono::steady_clock::time_point startTime = chrono::steady_clock::now();
+
+        // Probe each Set
+        for(int i=0; i < benchCase.accesses; i++) {
+            int firstLine = probeSet[i] * ways;
+            WayProbe probe;
+            if(useVector) {
+                probe = ProbeWaysVector(&tags[firstLine], &valid[firstLine], probeTag[i], ways);
+            }
+            else {
+                probe = ProbeWaysScalar(&tags[firstLine], &valid[firstLine], probeTag[i], ways);
+            }
+
+            // Hit, Empty Way, or LRU Victim
+            if(probe.hitWay >= 0) {
+                hits++;
+                checksum += probe.hitWay;
+            }
+            else if(probe.emptyWay >= 0) {
+                checksum += probe.emptyWay;
+            }
+            else if(useVector) {
+                checksum += FindLowestWayVector(&timeClock[firstLine], ways);
+            }
+            else {
+                checksum += FindLowestWayScalar(&timeClock[firstLine], ways);
+            }
+        }
+
+        // Keep the fastest
+        chrono::duration<double> elapsed = chrono::steady_clock::now() - startTime;
+        if((r == 0) || (elapsed.count() < best)) {
+            best = elapsed.count();
+        }
+
+        // Share of Probes that hit
+        hitRate = (double)hits / (double)benchCase.accesses;
+    }
+
+    return best;
+}
+
+/****************************************************************************************
+ * Function Name:       RunCases
+ * Input Parameters:    vector<BenchCase> &cases - represents the caches to simulate
+ *                      AddressTable &table - represents the parsed trace
+ *                      ostream &output - represents where the rows are written
+ * Return Value:        void
+ * Purpose:             Runs each sequence case and writes its row
+ ***************************************************************************************/
+void MemoryBench::RunCases(vector<BenchCase> &cases, AddressTable &table, ostream &output) {
+    // Run Case by Case
+    for(int i=0; i < (int)cases.size(); i++) {
+        double hitRate = 0;
+        double seconds = RunSequence(cases[i], table, hitRate);
+        PrintRow(output, cases[i], seconds, table.GetSize() / max(seconds, 1e-9),
+                "accesses/s", hitRate);
+    }
+}
+
+/****************************************************************************************
+ * Function Name:       PrintHeader
+ * Input Parameters:    ostream& - represents where the results are written
+ * Return Value:        void
+ * Purpose:             Writes the CSV column names, or opens the JSON results list
+ ***************************************************************************************/
+void MemoryBench::PrintHeader(ostream &output) {
+    // JSON: one object holding the results list
+    if(json) {
+        output << "{" << endl << "  \"benchmark\": \"memorybench\"," << endl;
+        output << "  \"results\": [" << endl;
+        return;
+    }
+
+    // CSV Columns
+    output << "group,accesses,cache_size,block_size,associativity,policy,";
+    output << "seconds,rate,unit,hit_rate" << endl;
+}
+
+/****************************************************************************************
+ * Function Name:       PrintRow
+ * Input Parameters:    ostream &output - represents where the row is written
+ *                      BenchCase &benchCase - represents the measured case
+ *                      double seconds - represents the fastest run time
+ *                      double rate - represents the measured throughput
+ *                      string unit - represents the unit of rate
+ *                      double hitRate - represents the case's hit rate
+ * Return Value:        void
+ * Purpose:             Writes one result as a CSV row or a JSON object. Parse rows
+ *                      have no cache, so their cache columns are 0 and policy empty.
+ ***************************************************************************************/
+void MemoryBench::PrintRow(ostream &output, BenchCase &benchCase, double seconds,
+        double rate, string unit, double hitRate) {
+    // Policy Name (Parse rows have no cache)
+    string policy = (benchCase.cacheSize > 0) ? GetPolicyName(benchCase.replacementPolicy) : "";
+
+    // Fixed number formats, so rows line up between runs
+    ostringstream numbers;
+    numbers << fixed << setprecision(6) << seconds;
+    string secondsText = numbers.str();
+    numbers.str("");
+    numbers << setprecision(2) << rate;
+    string rateText = numbers.str();
+    numbers.str("");
+    numbers << setprecision(6) << hitRate;
+    string hitRateText = numbers.str();
+
+    // JSON Object (Comma before every object but the first)
+    if(json) {
+        output << ((rows > 0) ? ",\n" : "") << "    {\"group\": \"" << benchCase.group;
+        output << "\", \"accesses\": " << benchCase.accesses;
+        output << ", \"cache_size\": " << benchCase.cacheSize;
+        output << ", \"block_size\": " << benchCase.blockSize;
+        output << ", \"associativity\": " << benchCase.mappingAssociation;
+        output << ", \"policy\": \"" << policy << "\", \"seconds\": " << secondsText;
+        output << ", \"rate\": " << rateText << ", \"unit\": \"" << unit;
+        output << "\", \"hit_rate\": " << hitRateText << "}";
+    }
+    // CSV Row
+    else {
+        output << benchCase.group << "," << benchCase.accesses << "," << benchCase.cacheSize;
+        output << "," << benchCase.blockSize << "," << benchCase.mappingAssociation << ",";
+        output << policy << "," << secondsText << "," << rateText << "," << unit << ",";
+        output << hitRateText << endl;
+    }
+
+    rows++;
+}
+
+/****************************************************************************************
+ * Function Name:       PrintFooter
+ * Input Parameters:    ostream& - represents where the results are written
+ * Return Value:        void
+ * Purpose:             Closes the JSON results list (CSV has no footer)
+ ***************************************************************************************/
+void MemoryBench::PrintFooter(ostream &output) {
+    // Close the list and the object
+    if(json) {
+        output << endl << "  ]" << endl << "}" << endl;
+    }
+}
+
+/*******************************************************************************
+ * --------------------- MAIN -------------------------------------------------
+ ******************************************************************************/
+int main(int argc, char* argv[]) {
+    // Run every measurement
+    MemoryBench bench;
+    return bench.Run(argc, argv);
+}
\ No newline at end of file
@@ -14,17 +14,77 @@
  *          configuration. Also reads a sequence of read and write operations from a
  *          text file to create a sequence of main memory addresses table and a cache
  *          memory table. Both tables are represented by classes of their own: 
- *          AddressTable and CacheTable.
+ *          AddressTable and CacheTable. The CacheEngine applies each memory access
+ *          to the CacheTable.
+ * 
+ *              The simulator can also run in streaming mode, where each memory 
+ *          access is simulated as soon as it is read from the text file. Streaming
+ *          mode does not store the Address Table, so memory use stays constant no 
+ *          matter how long the trace is.
+ * 
+ *              Sweep mode runs a whole list of cache configurations against one 
+ *          trace in a single pass using the SweepEngine.
+ * 
+ *              Miss ratio curve mode uses the StackDistance class to find the LRU
+ *          hit rate of every cache size and associativity in a single pass.
+ * 
+ *              The address table and cache table are written by the ResultWriter,
+ *          which buffers its output and can write CSV or a binary format instead,
+ *          print only a summary, sample rows, keep an address range, or write to a
+ *          file (see "ResultWriter.cpp").
+ * 
+ *              Every miss is also classified as compulsory, capacity, or conflict
+ *          by the MissClassifier, which follows the same accesses with a fully
+ *          associative LRU cache of the same size.
+ * 
+ *              The CacheEngine counts accesses, hits, and evictions per cache set.
+ *          With the "sets=N" output key, the HotspotReport prints how evenly the
+ *          accesses are spread over the sets and lists the hottest sets.
+ * 
+ *              With the "window=N" output key, the IntervalStats prints the hit 
+ *          rate, miss rate, writebacks, and unique blocks of every N accesses while 
+ *          the trace runs and reports where the program changes phase.
+ * 
+ *              Wherever a trace file name is asked for, a generator spec such as
+ *          "gen:zipf,accesses=1000000,footprint=65536" can be entered instead, and
+ *          the accesses are generated in memory (see "TraceGenerator.cpp").
+ * 
+ *              Hierarchy mode streams the trace through a chain of cache levels
+ *          (L1, L2, L3, ...) kept by the CacheHierarchy, which can be inclusive,
+ *          exclusive, or non-inclusive non-exclusive (NINE).
+ * 
+ *              Every mode except sweep and hierarchy asks for a write policy 
+ *          (write-back or write-through, write-allocate or no-write-allocate) and
+ *          an optional coalescing write buffer, and reports the bytes read from and
+ *          written to the next level, for a memory bandwidth estimate.
+ * 
+ *              With more than one thread, RunMemorySequence splits the cache sets 
+ *          among the threads. Sets never share cache lines, so every thread runs its
+ *          own shard of the cache and the results are identical to a serial run.
+ * 
+ *              Addresses are 64-bit, so traces from 64-bit machines (decimal or hex
+ *          addresses) can be simulated. The main memory size can be entered as
+ *          "2^N", up to 2^64 bytes.
  * 
  *          NOTE: Assumes user will only enter correct input.
  *  
  ***************************************************************************************/
 
 #include "AddressTable.cpp"
-#include "CacheTable.cpp"
+#include "CacheEngine.h"
+#include "TraceReader.cpp"
+#include "SweepEngine.cpp"
+#include "StackDistance.cpp"
+#include "MissClassifier.cpp"
+#include "CacheHierarchy.cpp"
+#include "HotspotReport.cpp"
+#include "IntervalStats.cpp"
+#include "Address.h"
 #include <iostream>
-#include <fstream>
 #include <string>
+#include <vector>
+#include <thread>
+#include <chrono>
 #include <math.h>
 using namespace std;
 
@@ -34,9 +94,23 @@ using namespace std;
  ***************************************************************************************/
 class MemorySim {
     public:
+        MemorySim();                                // Constructor
+
         // Lab Function to Run all required tests
         void RunAll();
 
+        // Runs the simulation while the text file is read
+        void RunStreaming();
+
+        // Runs a list of cache configurations against one text file
+        void RunSweep();
+
+        // Finds the LRU miss ratio of every cache size in one pass
+        void RunMissRatioCurve();
+
+        // Runs the text file through a multi-level cache hierarchy
+        void RunHierarchy();
+
         // User Functions
         void UserPrompt();
         void SimulatorOutput();
@@ -46,16 +120,48 @@ class MemorySim {
         void RunMemorySequence(); 
         void PrintAddressTable();
         void PrintHitRates();
+        void PrintTraffic();
         void PrintCacheTable();
 
+        // Output Functions
+        void OutputPrompt();
+        void PrintHotspots();
+
+        // Streaming Functions
+        void StreamFile();
+        void PrintStreamHitRates();
+
+        // Sweep Functions
+        void SweepPrompt();
+
+        // Miss Ratio Curve Functions
+        void MissRatioPrompt();
+
+        // Hierarchy Functions
+        bool HierarchyPrompt();
+
+        // Setter Function(s)
+        void SetThreads(int t);
+        void SetCache(Address mainMemorySize, int cacheSize, int blockSize,
+                int mappingAssociation, int replacementPolicy);
+        void SetAddressTable(AddressTable &table);
+
+        // Getter Function(s)
+        double GetHitRate();
+
     private:
         // Variables Set by User
-        int mainMemorySize;
+        Address mainMemorySize;                 // 0 = 2^64
         int cacheSize;
         int blockSize;
         int mappingAssociation;
-        bool replacementPolicy;
+        int replacementPolicy;
+        bool writeBack;
+        bool writeAllocate;
+        int writeBufferEntries;
         string fileName; 
+        string sweepFileName;
+        int threads;
 
         // Variables Calculated and Set by Program
         int addressLines;
@@ -66,7 +172,11 @@ class MemorySim {
 
         // Table Data Structures
         AddressTable addressSequenceTable;
-        CacheTable cacheMemoryTable;
+        CacheEngine cacheEngine;
+        MissClassifier missClassifier;
+        CacheHierarchy cacheHierarchy;
+        ResultWriter resultWriter;
+        IntervalStats intervalStats;
 
         // Math & Calculation Functions
         void CalculateAddressLines();
@@ -76,9 +186,27 @@ class MemorySim {
         void CalculateTotalCacheSize();
 
         // Helper Functions
-        string MakeBinaryTag(int address);
+        void RunMemorySequenceSharded();
+        void ShardWorker(CacheEngine* shardEngine, vector<int>* rows, vector<int>* hitRows);
+        void PrintThroughput(string label, long long bytes, 
+                chrono::steady_clock::time_point startTime,
+                chrono::steady_clock::time_point endTime = chrono::steady_clock::now());
+        void ReadMainMemorySize();
 };
 
+/****************************************************************************************
+ * Constructor
+ ***************************************************************************************/
+MemorySim::MemorySim() {
+    // Run Memory Sequence on a single thread by default
+    threads = 1;
+
+    // Write-back, write-allocate, no write buffer by default
+    writeBack = true;
+    writeAllocate = true;
+    writeBufferEntries = 0;
+}
+
 /****************************************************************************************
  * Function Name:       RunAll
  * Input Parameters:    void
@@ -88,6 +216,7 @@ class MemorySim {
 void MemorySim::RunAll() {
     // Prompt User for Information
     UserPrompt();
+    OutputPrompt();
 
     // Perform Simulator Output
     SimulatorOutput();
@@ -110,8 +239,192 @@ void MemorySim::RunAll() {
     // Calculate and Print the Hit Rates
     PrintHitRates();
 
+    // Print the Hottest Cache Sets (If asked for)
+    PrintHotspots();
+
+    // Print the Cache Table
+    PrintCacheTable();
+
+    // Finish the Output
+    resultWriter.Close();
+}
+
+/****************************************************************************************
+ * Function Name:       RunStreaming
+ * Input Parameters:    void
+ * Return Value:        void
+ * Purpose:             Runs the memory simulation in streaming mode. Each memory 
+ *                      access is simulated as soon as it is read from the text file,
+ *                      so the Address Table is never stored. Only the cache state and
+ *                      the hit counters are kept in memory.
+ ***************************************************************************************/
+void MemorySim::RunStreaming() {
+    // Prompt User for Information
+    UserPrompt();
+    OutputPrompt();
+
+    // OPT must know every future access, which streaming never stores
+    if(replacementPolicy == OPT_POLICY) {
+        cout << endl << "OPT replacement needs the whole trace; use the address table mode.";
+        cout << endl;
+        return;
+    }
+
+    // Perform Simulator Output
+    SimulatorOutput();
+
+    // Initialize the Cache Table
+    InitializeCacheTable();
+
+    // Read and Simulate User Text File
+    StreamFile();
+
+    // Print the Hit Rate
+    PrintStreamHitRates();
+
+    // Print the Hottest Cache Sets (If asked for)
+    PrintHotspots();
+
     // Print the Cache Table
     PrintCacheTable();
+
+    // Finish the Output
+    resultWriter.Close();
+}
+
+/****************************************************************************************
+ * Function Name:       RunSweep
+ * Input Parameters:    void
+ * Return Value:        void
+ * Purpose:             Runs every cache configuration listed in the user's sweep file
+ *                      against the user's text file. The text file is read once and
+ *                      the configurations are simulated in parallel. Prints one row
+ *                      per configuration.
+ ***************************************************************************************/
+void MemorySim::RunSweep() {
+    // Declare Sweep Engine
+    SweepEngine sweep;
+
+    // Prompt User for Information
+    SweepPrompt();
+
+    // Read Configurations
+    if(!sweep.ReadConfigFile(sweepFileName)) {
+        cout << endl << "Unable to open file: " << sweepFileName << endl;
+        return;
+    }
+
+    // Start timer for replay throughput
+    chrono::steady_clock::time_point startTime = chrono::steady_clock::now();
+
+    // Run all Configurations in one pass over the text file
+    if(!sweep.Run(fileName, mainMemorySize)) {
+        cout << endl << "Unable to open file: " << fileName << endl;
+        return;
+    }
+
+    // Stop timer before printing
+    chrono::steady_clock::time_point endTime = chrono::steady_clock::now();
+
+    // Print Results
+    cout << endl << "Sweep of " << sweep.GetSize() << " configurations on ";
+    cout << sweep.GetThreads() << " threads:" << endl;
+    sweep.Print();
+
+    // Print how fast the file was replayed
+    PrintThroughput("Sweep replay throughput", sweep.GetBytes(), startTime, endTime);
+}
+
+/****************************************************************************************
+ * Function Name:       RunMissRatioCurve
+ * Input Parameters:    void
+ * Return Value:        void
+ * Purpose:             Reads the user's text file once and calculates the LRU miss 
+ *                      ratio of every power-of-two cache size and associativity up to
+ *                      the largest cache size chosen by the user.
+ ***************************************************************************************/
+void MemorySim::RunMissRatioCurve() {
+    // Temporary Variables for each Memory Access
+    bool isWrite;
+    Address address;
+
+    // Stack Distance Engine and Trace Reader
+    StackDistance stackDistance;
+    TraceReader reader;
+
+    // Prompt User for Information
+    MissRatioPrompt();
+
+    // Start timer for replay throughput
+    chrono::steady_clock::time_point startTime = chrono::steady_clock::now();
+
+    // Open File
+    if(!reader.Open(fileName)) {
+        cout << endl << "Unable to open file: " << fileName << endl;
+        return;
+    }
+
+    // Record every access (cacheSize holds the largest cache size)
+    stackDistance.SetStackDistance(blockSize, cacheSize);
+    while(reader.Next(isWrite, address)) {
+        stackDistance.Access(address);
+    }
+
+    // Print Miss Ratio Curve
+    stackDistance.Print();
+
+    // Print how fast the file was replayed
+    PrintThroughput("Stack distance throughput", reader.GetFileSize(), startTime);
+
+    // Close File
+    reader.Close();
+}
+
+/****************************************************************************************
+ * Function Name:       RunHierarchy
+ * Input Parameters:    void
+ * Return Value:        void
+ * Purpose:             Streams the user's text file through the cache hierarchy and
+ *                      prints the hits, misses, and writebacks of every level along
+ *                      with the main memory traffic.
+ ***************************************************************************************/
+void MemorySim::RunHierarchy() {
+    // Temporary Variables for each Memory Access
+    bool isWrite;
+    Address address;
+
+    // Trace Reader for memory-mapped file
+    TraceReader reader;
+
+    // Prompt User for Information (OPT levels are refused)
+    if(!HierarchyPrompt()) {
+        cout << endl << "OPT replacement needs the whole trace; use the address table mode.";
+        cout << endl;
+        return;
+    }
+
+    // Start timer for replay throughput
+    chrono::steady_clock::time_point startTime = chrono::steady_clock::now();
+
+    // Open File
+    if(!reader.Open(fileName)) {
+        cout << endl << "Unable to open file: " << fileName << endl;
+        return;
+    }
+
+    // Simulate every Access
+    while(reader.Next(isWrite, address)) {
+        cacheHierarchy.Access(address, isWrite);
+    }
+
+    // Print Results
+    cacheHierarchy.Print();
+
+    // Print how fast the file was replayed
+    PrintThroughput("Hierarchy replay throughput", reader.GetFileSize(), startTime);
+
+    // Close File
+    reader.Close();
 }
 
 /****************************************************************************************
@@ -120,15 +433,15 @@ void MemorySim::RunAll() {
  * Return Value:        void
  * Purpose:             Collects and Stores user input for main memory size, cache 
  *                      size, block size, mapping associativity, replacement policy,
- *                      and input file name. 
+ *                      write policy, write buffer size, and input file name. 
  ***************************************************************************************/
 void MemorySim::UserPrompt() {
     // Temporary Variable for Char Input
     char userCharInput;
 
     // Prompt User for Main Memory Size
-    cout << "Enter the size of Main Memory in bytes: ";
-    cin >> mainMemorySize;
+    cout << "Enter the size of Main Memory in bytes (or 2^N): ";
+    ReadMainMemorySize();
 
     // Prompt User for Cache Size
     cout << "Enter the size of the cache in bytes: ";
@@ -144,19 +457,30 @@ void MemorySim::UserPrompt() {
     cin >> mappingAssociation;
 
     // Prompt User for Replacement Policy
-    cout << "Enter the replacement policy (L = LRU, F = FIFO): ";
+    cout << "Enter the replacement policy (L = LRU, F = FIFO, O = OPT, P = tree PLRU, ";
+    cout << "S = SRRIP, B = BRRIP, R = random, U = LFU): ";
     cin >> userCharInput;
 
-    // Convert char input to bool
-    // LRU = 0/FALSE, FIFO = 1/TRUE
-    if(userCharInput == 'L') {
-        // User chose LRU Replacement Policy
-        replacementPolicy = 0;
-    } 
-    else {
-        // User chose FIFO Replacement Policy
-        replacementPolicy = 1;
-    }
+    // Convert char input to policy (Unknown letters are FIFO)
+    replacementPolicy = ParsePolicy(userCharInput);
+
+    // Prompt User for Write Hit Policy
+    cout << "Enter the write policy (B = write-back, T = write-through): ";
+    cin >> userCharInput;
+
+    // Convert char input to bool (Unknown letters are write-back)
+    writeBack = (userCharInput != 'T');
+
+    // Prompt User for Write Miss Policy
+    cout << "Enter the write miss policy (A = write-allocate, N = no-write-allocate): ";
+    cin >> userCharInput;
+
+    // Convert char input to bool (Unknown letters are write-allocate)
+    writeAllocate = (userCharInput != 'N');
+
+    // Prompt User for Write Buffer Size
+    cout << "Enter the number of write buffer entries (0 = no write buffer): ";
+    cin >> writeBufferEntries;
 
     // Prompt User for Text File Name
     cout << "Enter the name of the input file containing the list ";
@@ -199,35 +523,360 @@ void MemorySim::SimulatorOutput() {
  * Purpose:             Opens the text file chosen by the User and reads the first 
  *                      line to know how many memory address sequences there are. It
  *                      then adds each memory access as a row to the Address Table.
+ *                      The file is parsed in place by the Trace Reader, and the parse
+ *                      throughput is printed when done.
  ***************************************************************************************/
 void MemorySim::ReadFile() {
-    // Temporary Variable for File Line
-    string line;
+    // Temporary Variables for each Memory Access
+    bool isWrite;
+    Address address;
+
+    // Trace Reader for memory-mapped file
+    TraceReader reader;
+
+    // Start timer for parse throughput
+    chrono::steady_clock::time_point startTime = chrono::steady_clock::now();
 
     // Open File
-    ifstream file (fileName);
+    if(!reader.Open(fileName)) {
+        cout << endl << "Unable to open file: " << fileName << endl;
+        return;
+    }
 
-    // Read First Line
-    getline(file,line);
+    // A clamped count is too long for the Address Table (Only streaming mode runs it)
+    if(reader.GetSize() >= MAX_TRACE_SIZE) {
+        cout << endl << "Too many memory accesses for the address table in: " << fileName;
+        cout << " (use streaming mode)" << endl;
+        reader.Close();
+        return;
+    }
 
     // Set Address Table's size to number on first line of Text File
-    // Note: stoi() converts the string to integer
-    addressSequenceTable.SetSize(stoi(line));
+    addressSequenceTable.SetSize(reader.GetSize());
+
+    // Read Access by Access of File
+    while(reader.Next(isWrite, address)) {
+        // Add Row to the Sequence Table
+        addressSequenceTable.AddRow(isWrite, address);
+    }
 
-    // Read Line by Line of File
-    while(getline(file,line)) {
-        // Skip if line is empty
-        if(line.length() != 0) {
-            // Add Row to the Sequence Table
-            addressSequenceTable.AddRow(line);
+    // Print how fast the file was parsed
+    PrintThroughput("Trace parse throughput", reader.GetFileSize(), startTime);
 
-            // Update Cache Table
-            //cacheMemoryTable.Update(line);
-        } 
+    // Close File
+    reader.Close();
+}
+
+/****************************************************************************************
+ * Function Name:       OutputPrompt
+ * Input Parameters:    void
+ * Return Value:        void
+ * Purpose:             Asks the user how the address table and cache table should be
+ *                      written (see "ResultWriter.cpp"). Large traces are usually run
+ *                      with a summary, sampled rows, or a file. 'y' and 'n' are 
+ *                      accepted for a table and a summary.
+ ***************************************************************************************/
+void MemorySim::OutputPrompt() {
+    // Temporary Variable for String Input
+    string outputSpec;
+
+    // Prompt User for Output
+    cout << "Enter the output (table, csv, binary, or summary, optionally followed by ";
+    cout << ",every=N ,from=ADDRESS ,to=ADDRESS ,file=NAME ,sets=N ,window=N): ";
+    cin >> outputSpec;
+
+    // Yes/No for a table or a summary
+    if(outputSpec == "y") {
+        outputSpec = "table";
+    }
+    else if(outputSpec == "n") {
+        outputSpec = "summary";
+    }
+
+    // Set up the Result Writer (Unknown output is a table on the console)
+    if(!resultWriter.SetWriter(outputSpec)) {
+        cout << "Unknown output: " << outputSpec << ", printing the table" << endl;
+        resultWriter.SetWriter("table");
+    }
+    if(!resultWriter.Open()) {
+        cout << "Unable to open output file, printing to the console" << endl;
+    }
+}
+
+/****************************************************************************************
+ * Function Name:       PrintHotspots
+ * Input Parameters:    void
+ * Return Value:        void
+ * Purpose:             Prints the per-set distribution and the hottest and most 
+ *                      conflicted cache sets when the output spec has "sets=N"
+ ***************************************************************************************/
+void MemorySim::PrintHotspots() {
+    // No report unless asked for
+    if(resultWriter.GetHotspotSets() == 0) {
+        return;
+    }
+
+    // Summarize the Cache Engine's per-set counters
+    HotspotReport report;
+    report.Collect(cacheEngine);
+    report.Print(resultWriter.GetHotspotSets());
+}
+
+/****************************************************************************************
+ * Function Name:       StreamFile
+ * Input Parameters:    void
+ * Return Value:        void
+ * Purpose:             Opens the text file chosen by the User and simulates each 
+ *                      memory access as soon as it is parsed. The number of accesses
+ *                      on the first line is not needed since nothing is stored.
+ ***************************************************************************************/
+void MemorySim::StreamFile() {
+    // Chunk of decoded Memory Accesses and their results
+    vector<TraceRecord> chunk;
+    vector<AccessResult> results;
+    chunk.reserve(ACCESS_CHUNK_SIZE);
+    results.reserve(ACCESS_CHUNK_SIZE);
+
+    // Trace Reader for memory-mapped file
+    TraceReader reader;
+
+    // Start timer for replay throughput
+    chrono::steady_clock::time_point startTime = chrono::steady_clock::now();
+
+    // Open File
+    if(!reader.Open(fileName)) {
+        cout << endl << "Unable to open file: " << fileName << endl;
+        return;
+    }
+
+    // Row number of each access
+    long long row = 0;
+
+    // Write Column Headers if Rows are written
+    bool writeRows = resultWriter.GetWritesRows();
+    if(writeRows) {
+        resultWriter.WriteHeader(blockSize, cacheEngine.GetCacheSets(), mappingAssociation);
+    }
+
+    // Accesses per window (0 if not chosen by User)
+    long long windowSize = resultWriter.GetWindowSize();
+
+    // Read Chunk by Chunk of File
+    while(reader.NextChunk(chunk, ACCESS_CHUNK_SIZE) > 0) {
+        // Simulate the chunk's Accesses
+        cacheEngine.AccessChunk(chunk, results);
+
+        // Go through the results Access by Access
+        for(int i=0; i < (int)chunk.size(); i++) {
+            Address address = chunk[i].address;
+            bool hit = results[i].hit;
+
+            // Classify the access if it missed
+            missClassifier.Access(address, hit);
+
+            // Write Row if chosen by User
+            if(writeRows) {
+                resultWriter.WriteRow(row, address, chunk[i].isWrite, 
+                        cacheEngine.GetMMBlock(address), cacheEngine.GetCMSet(address),
+                        cacheEngine.GetFirstCMBlock(address), mappingAssociation, hit);
+            }
+            row++;
+
+            // Count the access in its window (Rows go out before the window's line)
+            if(windowSize > 0) {
+                if(writeRows && (row % windowSize == 0)) {
+                    resultWriter.Flush();
+                }
+                intervalStats.Access(address, results[i]);
+            }
+        }
     }
 
+    // Write the rows still buffered
+    resultWriter.Flush();
+
+    // Print the last window and the phases
+    intervalStats.Finish();
+
+    // Send the writes still buffered
+    cacheEngine.FlushWriteBuffer();
+
+    // Print how fast the file was parsed and simulated
+    PrintThroughput("Trace replay throughput", reader.GetFileSize(), startTime);
+
     // Close File
-    file.close();
+    reader.Close();
+}
+
+/****************************************************************************************
+ * Function Name:       SweepPrompt
+ * Input Parameters:    void
+ * Return Value:        void
+ * Purpose:             Collects and Stores user input for main memory size, the sweep
+ *                      configuration file name, and the input file name.
+ ***************************************************************************************/
+void MemorySim::SweepPrompt() {
+    // Prompt User for Main Memory Size
+    cout << "Enter the size of Main Memory in bytes (or 2^N): ";
+    ReadMainMemorySize();
+
+    // Prompt User for Sweep File Name
+    cout << "Enter the name of the sweep file (one \"cache size, block size, ";
+    cout << "associativity, policy letter\" configuration per line): ";
+    cin >> sweepFileName;
+
+    // Prompt User for Text File Name
+    cout << "Enter the name of the input file containing the list ";
+    cout << "of memory references generated by the CPU: ";
+    cin >> fileName;
+}
+
+/****************************************************************************************
+ * Function Name:       MissRatioPrompt
+ * Input Parameters:    void
+ * Return Value:        void
+ * Purpose:             Collects and Stores user input for block size, largest cache
+ *                      size, and input file name.
+ ***************************************************************************************/
+void MemorySim::MissRatioPrompt() {
+    // Prompt User for Block Size
+    cout << "Enter the cache block/line size: ";
+    cin >> blockSize;
+
+    // Prompt User for Largest Cache Size
+    cout << "Enter the largest cache size in bytes: ";
+    cin >> cacheSize;
+
+    // Prompt User for Text File Name
+    cout << "Enter the name of the input file containing the list ";
+    cout << "of memory references generated by the CPU: ";
+    cin >> fileName;
+}
+
+/****************************************************************************************
+ * Function Name:       HierarchyPrompt
+ * Input Parameters:    void
+ * Return Value:        bool - represents whether the hierarchy can be streamed (0 if
+ *                      a level chose OPT)
+ * Purpose:             Collects main memory size, block size, the size, 
+ *                      associativity, and replacement policy of each level, the 
+ *                      inclusion mode, and the input file name. Sets up the Cache
+ *                      Hierarchy.
+ ***************************************************************************************/
+bool MemorySim::HierarchyPrompt() {
+    // Temporary Variables for User Input
+    char userCharInput;
+    int levels;
+    bool canStream = true;
+
+    // Prompt User for Main Memory Size
+    cout << "Enter the size of Main Memory in bytes (or 2^N): ";
+    ReadMainMemorySize();
+
+    // Prompt User for Block Size (Shared by every level)
+    cout << "Enter the cache block/line size: ";
+    cin >> blockSize;
+
+    // Prompt User for Number of Levels
+    cout << "Enter the number of cache levels: ";
+    cin >> levels;
+
+    // Prompt User for each Level, starting at L1
+    for(int i=1; i <= levels; i++) {
+        cout << endl << "Enter the size of the L" << i << " cache in bytes: ";
+        cin >> cacheSize;
+        cout << "Enter the degree of set-associativity of L" << i << ": ";
+        cin >> mappingAssociation;
+        cout << "Enter the replacement policy of L" << i << " (L = LRU, F = FIFO, ";
+        cout << "P = tree PLRU, S = SRRIP, B = BRRIP, R = random, U = LFU): ";
+        cin >> userCharInput;
+        replacementPolicy = ParsePolicy(userCharInput);
+
+        // OPT must know every future access, which streaming never stores
+        if(replacementPolicy == OPT_POLICY) {
+            canStream = false;
+        }
+
+        // Add Level below the previous one
+        cacheHierarchy.AddLevel(cacheSize, mappingAssociation, replacementPolicy);
+    }
+
+    // Prompt User for Inclusion Mode
+    cout << endl << "Enter the inclusion mode (I = inclusive, E = exclusive, ";
+    cout << "N = non-inclusive non-exclusive): ";
+    cin >> userCharInput;
+
+    // Prompt User for Text File Name
+    cout << "Enter the name of the input file containing the list ";
+    cout << "of memory references generated by the CPU: ";
+    cin >> fileName;
+
+    // Create the Levels
+    cacheHierarchy.SetHierarchy(mainMemorySize, blockSize, ParseInclusion(userCharInput));
+
+    return canStream;
+}
+
+/****************************************************************************************
+ * Function Name:       SetThreads
+ * Input Parameters:    int - represents the number of threads to use
+ * Return Value:        void
+ * Purpose:             Sets how many threads RunMemorySequence splits the cache 
+ *                      sets among. 1 runs the memory sequence serially.
+ ***************************************************************************************/
+void MemorySim::SetThreads(int t) {
+    // At least one thread is needed
+    threads = max(t, 1);
+}
+
+/****************************************************************************************
+ * Function Name:       SetCache
+ * Input Parameters:    Address mainMemorySize - represents the size of main memory in
+ *                      bytes (0 = 2^64)
+ *                      int cacheSize - represents the size of the cache in bytes
+ *                      int blockSize - represents the size of a block in bytes
+ *                      int mappingAssociation - represents the ways per set
+ *                      int replacementPolicy - represents the replacement policy
+ * Return Value:        void
+ * Purpose:             Sets the cache configuration without prompting, for programs
+ *                      such as the benchmark that drive the simulator themselves
+ ***************************************************************************************/
+void MemorySim::SetCache(Address mainMemorySize, int cacheSize, int blockSize,
+        int mappingAssociation, int replacementPolicy) {
+    // Store Cache Configuration
+    this->mainMemorySize = mainMemorySize;
+    this->cacheSize = cacheSize;
+    this->blockSize = blockSize;
+    this->mappingAssociation = mappingAssociation;
+    this->replacementPolicy = replacementPolicy;
+}
+
+/****************************************************************************************
+ * Function Name:       SetAddressTable
+ * Input Parameters:    AddressTable& - represents an already parsed trace
+ * Return Value:        void
+ * Purpose:             Copies a parsed trace into the Address Table instead of reading
+ *                      the text file
+ ***************************************************************************************/
+void MemorySim::SetAddressTable(AddressTable &table) {
+    // Copy Address Table
+    addressSequenceTable = table;
+}
+
+/****************************************************************************************
+ * Function Name:       GetHitRate
+ * Input Parameters:    void
+ * Return Value:        double - represents the fraction of accesses that hit (0 to 1)
+ * Purpose:             Returns the hit rate counted by the Cache Engine
+ ***************************************************************************************/
+double MemorySim::GetHitRate() {
+    // Guard against an empty trace
+    if(cacheEngine.GetTotalAccesses() == 0) {
+        return 0;
+    }
+
+    // Hits over Accesses
+    return (double)cacheEngine.GetTotalHits() / (double)cacheEngine.GetTotalAccesses();
 }
 
 /****************************************************************************************
@@ -238,26 +887,37 @@ void MemorySim::ReadFile() {
  *                      no read or write operations have occurred yet)
  ***************************************************************************************/
 void MemorySim::InitializeCacheTable() {
-    // Initialize CacheTable with cacheLines and Tag Size
-    cacheMemoryTable.SetCache((cacheSize / blockSize), tag);
+    // Initialize Cache Engine, which creates the CacheTable with cacheLines and Tag Size
+    cacheEngine.SetEngine(mainMemorySize, cacheSize, blockSize, mappingAssociation, 
+            replacementPolicy);
+
+    // Handle writes as chosen by the User
+    cacheEngine.SetWritePolicy(writeBack, writeAllocate, writeBufferEntries);
+
+    // Initialize Miss Classifier with a shadow cache of the same size
+    missClassifier.SetClassifier(cacheSize, blockSize);
+
+    // Report every window of accesses if chosen by User
+    intervalStats.SetIntervals(resultWriter.GetWindowSize(), blockSize);
 }
 
 /****************************************************************************************
  * Function Name:       PopulateAddressTable
  * Input Parameters:    void
  * Return Value:        void
- * Purpose:             Fills the main memory block, cache memory set, and cache memory 
- *                      block columns of the Address Table.
+ * Purpose:             Gives the Address Table the cache geometry its main memory
+ *                      block, cache memory set, and cache memory block columns are
+ *                      worked out from, and fills the next uses for OPT.
  ***************************************************************************************/
 void MemorySim::PopulateAddressTable() {
-    // Populate Main Memory Blocks
-    addressSequenceTable.CalculateMMBlock(blockSize);
+    // Main Memory Blocks, Cache Memory Sets, and Cache Memory Blocks follow from the
+    // geometry (Worked out per row when printed)
+    addressSequenceTable.SetGeometry(cacheSize, blockSize, mappingAssociation);
 
-    // Populate Cache Memory Set Numbers
-    addressSequenceTable.CalculateCMSet(cacheSize, blockSize, mappingAssociation);
-
-    // Populate Cache Memory Block Numbers
-    addressSequenceTable.CalculateCMBlock(mappingAssociation);
+    // Populate Next Uses (Only OPT replacement looks at the future)
+    if(replacementPolicy == OPT_POLICY) {
+        addressSequenceTable.CalculateNextUse(blockSize);
+    }
 }
 
 /****************************************************************************************
@@ -265,139 +925,62 @@ void MemorySim::PopulateAddressTable() {
  * Input Parameters:    void
  * Return Value:        void
  * Purpose:             Goes row by row and performs each memory access in the order
- *                      they appeared on the text file. Populates the Cache Table
- *                      
- *                      3 Major components/cases occuring here:
- *                          
- *                          1. The program is looking for a valid bit of 1 and a tag
- *                          match to populate the isHit column of the Address Table
- * 
- *                          2. The program is searching for an empty cache memory
- *                          block in the Cache Table to store tag info, valid bit,
- *                          dirty bit, and data into. 
- *                          
- *                          3. The program is replacing occupied cache memory blocks
- *                          using the user's chosen replacement policy. 
+ *                      they appeared on the text file. The Cache Engine populates the
+ *                      Cache Table and reports whether each access was a hit, which 
+ *                      populates the isHit column of the Address Table.
  * 
  *                      At the end of this function, the Cache Table will appear how
  *                      cache memory would look after the set of reads and writes
  *                      provided in the text file.
  ***************************************************************************************/
 void MemorySim::RunMemorySequence() {    
-    // For each line of Sequence Table, Get cache block numbers and check them for Tag
-    for(int i=0; i < (addressSequenceTable.GetSize()); i++) {
-        // Declare variable for whether Tag was Found and variable for temporary Tag
-        bool tagFound = false;
-        string tempTag = MakeBinaryTag(addressSequenceTable.GetMMAddress(i));
-        
-        // Declare a firstCMBlock integer
-        int firstCMBlock = addressSequenceTable.GetFirstCMBlock(i);
-
-        // Declare index variable for Case 3 to compare clock times
-        int index = firstCMBlock;
-
-        // Case 1: Search for a Tag Match
-        for(int j=0; j < mappingAssociation; j++) {
-            // Check the valid bit at all cache memory blocks that item can be mapped to
-            // Loop below won't run once tag is found
-            if((!tagFound) && (cacheMemoryTable.GetValidBit(j + firstCMBlock))) {
-                // Check if tag is a match
-                if(tempTag == cacheMemoryTable.GetBinaryTag(j + firstCMBlock)) {
-                    // Set Hit on Address Table
-                    addressSequenceTable.SetHit(i);
-
-                    // If IsWrite operation, Set Dirty Bit to true on Cache Table
-                    if(addressSequenceTable.GetIsWrite(i)) {
-                        cacheMemoryTable.SetDirtyBit((j + firstCMBlock), true);
-                    }
-
-                    // Set clockTime for LRU
-                    // replacement policy = 0, LRU 
-                    if(!replacementPolicy) {
-                        // Update clock time whenever accessed in Case 1 or Case 3
-                        cacheMemoryTable.SetTimeClock(j + firstCMBlock);
-                    }
-
-                    // Set tagFound bit
-                    tagFound = true;
-                }
-            }
-        }
-
-        // Case 2: Search for Empty Spot for New Tag
-        // Check all cache memory blocks
-        for(int j=0; j < mappingAssociation; j++) {
-            // Check for false valid bit, means the block is empty
-            if((!tagFound) && ((cacheMemoryTable.GetValidBit(j + firstCMBlock)) == 0)) {
-                // Set the Valid Bit
-                cacheMemoryTable.SetValidBit(j + firstCMBlock, 1);
-
-                // Check if isWrite operation
-                if(addressSequenceTable.GetIsWrite(i)) {
-                    // Set Dirty Bit to true on Cache Table
-                    cacheMemoryTable.SetDirtyBit((j + firstCMBlock), true);
-                }
-
-                // Set Tag
-                cacheMemoryTable.SetBinaryTag((j + firstCMBlock), addressSequenceTable.GetMMAddress(i), addressLines);
-
-                // Set Data
-                cacheMemoryTable.SetData((j + firstCMBlock), (addressSequenceTable.GetMMBlock(i)));
-
-                // Set Clock Time
-                cacheMemoryTable.SetTimeClock(j + firstCMBlock);
-
-                // Set tagFound bit
-                tagFound = true;
-            }
+    // Split the cache sets among threads if more than one thread is used (A write 
+    // buffer is shared by every set, and windows follow file order, so both need a
+    // serial run)
+    if((threads > 1) && (writeBufferEntries == 0) && !intervalStats.GetIsEnabled()) {
+        RunMemorySequenceSharded();
+
+        // Classify misses in file order (Shadow cache is not split by set)
+        for(int i=0; i < (addressSequenceTable.GetSize()); i++) {
+            missClassifier.Access(addressSequenceTable.GetMMAddress(i), 
+                    addressSequenceTable.GetIsHit(i));
         }
+        return;
+    }
 
-        // Case 3: No Empty Spots, Find FIFO/LRU cache block
-        // If LRU, replacement policy = 0 
-        // (Set Time Clock whenever accessed in Case 1 or 3)
-        // If FIFO, replacement policy = 1 
-        // (Only Set Time Clock whenever accessed in Case 3)
-        if(!tagFound) {
-            // Check all cache memory blocks
-            for(int j=0; j < mappingAssociation; j++) {
-                
-                // Compare time clock at each cache memory block
-                if(cacheMemoryTable.GetTimeClock(j + firstCMBlock) < cacheMemoryTable.GetTimeClock(index)) {
-                    // Lower time clock means FIFO or LRU item
-                    // Set index to smaller value
-                    index = j + firstCMBlock;
-                }
+    // Chunk of Memory Accesses and their results
+    vector<TraceRecord> chunk;
+    vector<AccessResult> results;
+
+    // For each chunk of lines of Sequence Table, perform the memory accesses
+    int rows = addressSequenceTable.GetSize();
+    for(int first=0; first < rows; first += ACCESS_CHUNK_SIZE) {
+        // Access the cache with the chunk's rows
+        addressSequenceTable.GetChunk(first, ACCESS_CHUNK_SIZE, chunk);
+        cacheEngine.AccessChunk(chunk, results);
+
+        // Go through the results row by row
+        for(int j=0; j < (int)chunk.size(); j++) {
+            // Set Hit on Address Table if the tag was found
+            if(results[j].hit) {
+                addressSequenceTable.SetHit(first + j);
             }
 
-            // Index = least recently used item or first item entered
-            // Replace item at index
-
-            // Set Valid Bit
-            cacheMemoryTable.SetValidBit(index, 1);
+            // Classify the access if it missed
+            missClassifier.Access(chunk[j].address, results[j].hit);
 
-            // Check if isWrite operation
-            if(addressSequenceTable.GetIsWrite(i)) {
-                // Set Dirty Bit to true on Cache Table
-                cacheMemoryTable.SetDirtyBit(index, 1);
+            // Count the access in its window if chosen by User
+            if(intervalStats.GetIsEnabled()) {
+                intervalStats.Access(chunk[j].address, results[j]);
             }
-            else {
-                // Set Dirty Bit to false if not a write operation
-                cacheMemoryTable.SetDirtyBit(index, 0);
-            }
-
-            // Set Tag
-            cacheMemoryTable.SetBinaryTag(index, addressSequenceTable.GetMMAddress(i), addressLines);
-
-            // Set Data
-            cacheMemoryTable.SetData(index, (addressSequenceTable.GetMMBlock(i)));
-
-            // Set Clock Time
-            cacheMemoryTable.SetTimeClock(index);
-
-            // Set tagFound true
-            tagFound = true;
         }
     }
+
+    // Print the last window and the phases
+    intervalStats.Finish();
+
+    // Send the writes still buffered
+    cacheEngine.FlushWriteBuffer();
 }
 
 /****************************************************************************************
@@ -405,50 +988,36 @@ void MemorySim::RunMemorySequence() {
  * Input Parameters:    void
  * Return Value:        void
  * Purpose:             Calls the Print function from the Address Table structure to
- *                      print the address sequence table as the user would see it.
+ *                      write the address sequence table in the format chosen by the
+ *                      user. Nothing is written for a summary.
  ***************************************************************************************/
 void MemorySim::PrintAddressTable() {
-    // Print the Address Table
-    addressSequenceTable.Print();
+    // Skip the rows of a summary
+    if(!resultWriter.GetWritesRows()) {
+        return;
+    }
+
+    // Write the Address Table, then anything still buffered
+    resultWriter.WriteHeader(blockSize, cacheEngine.GetCacheSets(), mappingAssociation);
+    addressSequenceTable.Print(resultWriter);
+    resultWriter.Flush();
 }
 
 /****************************************************************************************
  * Function Name:       PrintHitRates
  * Input Parameters:    void
  * Return Value:        void
- * Purpose:             Calculates the highest possible hit rate by storing one of 
- *                      each main memory block in a vector. The size of the vector
- *                      indicates how many unique main memory blocks are going to be
- *                      accessed. Subtracting total reads and writes by the size of
- *                      the tempBlocks vector yields the highest total Hits that 
- *                      can occur.
+ * Purpose:             Calculates the highest possible hit rate from the number of
+ *                      unique main memory blocks accessed. The Miss Classifier counts 
+ *                      them while the memory sequence runs (the first access to a
+ *                      block is a compulsory miss). Subtracting total reads and 
+ *                      writes by the number of unique blocks yields the highest total
+ *                      Hits that can occur.
  ***************************************************************************************/
 void MemorySim::PrintHitRates() {
-    // Declare vector to count multiple instances of mm block access
-    vector<int> tempBlocks;
-
-    // Calculate total Hits Possible
-    for(int i=0; i < addressSequenceTable.GetSize(); i++) {
-        // Declare flag for whether mmblock was found in temp vector
-        bool blockFound = false;
-
-        for(int j=0; j < tempBlocks.size(); j++) {
-            if (addressSequenceTable.GetMMBlock(i) == tempBlocks.at(j)) {
-                // Set blockFound flag to true if mmblock found
-                blockFound = true;
-            }
-        }
-
-        // If block wasn't found
-        if(!blockFound) {
-            // Add block to temp vector
-            tempBlocks.push_back(addressSequenceTable.GetMMBlock(i));
-        }
-    }
-
     // Calculate Total Hits
-    int totalAccesses = addressSequenceTable.GetSize();
-    int totalHits = totalAccesses - tempBlocks.size();
+    long long totalAccesses = addressSequenceTable.GetSize();
+    long long totalHits = totalAccesses - missClassifier.GetUniqueBlocks();
 
     // Calculate Highest Possible Hit rate
     double highestHitRate = 100.0 * ((double)totalHits / (double)totalAccesses);
@@ -460,8 +1029,79 @@ void MemorySim::PrintHitRates() {
     // Calculate & Print Actual Hit Rate
     addressSequenceTable.CalculateActualHitRate();
 
-    // Free up memory space, Clear vector
-    tempBlocks.clear();
+    // Print Compulsory, Capacity, and Conflict Miss Rates
+    missClassifier.Print();
+
+    // Print Next Level Traffic
+    PrintTraffic();
+}
+
+/****************************************************************************************
+ * Function Name:       PrintStreamHitRates
+ * Input Parameters:    void
+ * Return Value:        void
+ * Purpose:             Prints the highest possible and actual hit rates from the 
+ *                      Cache Engine's counters. Used by streaming mode, which has no
+ *                      Address Table to count hits from.
+ ***************************************************************************************/
+void MemorySim::PrintStreamHitRates() {
+    // Get Total Accesses and Hits from the Cache Engine, Unique Blocks from the Miss
+    // Classifier
+    long long totalAccesses = cacheEngine.GetTotalAccesses();
+    long long totalHits = cacheEngine.GetTotalHits();
+    long long possibleHits = totalAccesses - missClassifier.GetUniqueBlocks();
+
+    // Calculate highest possible and actual hit rates
+    double highestHitRate = 100.0 * ((double)possibleHits / (double)totalAccesses);
+    double actualHitRate = 100.0 * ((double)totalHits / (double)totalAccesses);
+
+    // Print Highest Possible Hit Rate
+    cout << endl << "Highest possible hit rate = " << possibleHits << "/" << totalAccesses;
+    cout << " = " << highestHitRate << "%" << endl;
+
+    // Print Actual Hit Rate
+    cout << "Actual hit rate = " << totalHits << "/" << totalAccesses << " = ";
+    cout << actualHitRate << "%" << endl;
+
+    // Print Compulsory, Capacity, and Conflict Miss Rates
+    missClassifier.Print();
+
+    // Print Next Level Traffic
+    PrintTraffic();
+}
+
+/****************************************************************************************
+ * Function Name:       PrintTraffic
+ * Input Parameters:    void
+ * Return Value:        void
+ * Purpose:             Prints the bytes the cache read from and wrote to the next 
+ *                      level, and the average traffic per memory access. Dirty lines 
+ *                      still in the cache at the end are not counted.
+ ***************************************************************************************/
+void MemorySim::PrintTraffic() {
+    // Get Traffic from the Cache Engine
+    long long totalAccesses = cacheEngine.GetTotalAccesses();
+    long long bytesRead = cacheEngine.GetBytesRead();
+    long long bytesWritten = cacheEngine.GetBytesWritten();
+
+    // Calculate average bytes per access
+    double bytesPerAccess = (double)(bytesRead + bytesWritten) / (double)totalAccesses;
+
+    // Print Write Policy
+    cout << endl << "Write policy = " << (writeBack ? "write-back" : "write-through");
+    cout << ", " << (writeAllocate ? "write-allocate" : "no-write-allocate") << endl;
+
+    // Print Traffic
+    cout << "Bytes read from next level = " << bytesRead << endl;
+    cout << "Bytes written to next level = " << bytesWritten << endl;
+    cout << "Next level traffic = " << (bytesRead + bytesWritten) << "/" << totalAccesses;
+    cout << " = " << bytesPerAccess << " bytes per access" << endl;
+
+    // Print Write Buffer Merges
+    if(writeBufferEntries > 0) {
+        cout << "Writes coalesced by the " << writeBufferEntries << "-entry write buffer = ";
+        cout << cacheEngine.GetCoalescedWrites() << endl;
+    }
 }
 
 /****************************************************************************************
@@ -469,11 +1109,15 @@ void MemorySim::PrintHitRates() {
  * Input Parameters:    void
  * Return Value:        void
  * Purpose:             Calls the Print function from the Cache Table structure to 
- *                      print the cache memory table as the user would see it
+ *                      print the cache memory table as the user would see it, to the
+ *                      console or the output file. CSV and binary outputs skip it.
  ***************************************************************************************/
 void MemorySim::PrintCacheTable() {
     // Call Cache Table Print Function
-    cacheMemoryTable.Print();
+    if(resultWriter.GetWritesCacheTable()) {
+        cacheEngine.Print(resultWriter.GetStream());
+        resultWriter.Flush();
+    }
 }
 
 /****************************************************************************************
@@ -482,11 +1126,11 @@ void MemorySim::PrintCacheTable() {
  * Return Value:        void
  * Purpose:             Calculates and stores the number of address lines needed 
  *                      based on the size of Main Memory. Address Lines = log2 (Main 
- *                      Memory Size)
+ *                      Memory Size), up to 64 for a 2^64-byte main memory
  ***************************************************************************************/
 void MemorySim::CalculateAddressLines() {
     // Calculate number of required address lines
-    addressLines = log2(mainMemorySize);
+    addressLines = GetAddressBits(mainMemorySize);
 }
 
 /****************************************************************************************
@@ -523,8 +1167,9 @@ void MemorySim::CalculateIndexBits() {
  *                      to log2(N * (main memory size / cache memory size)).
  ***************************************************************************************/
 void MemorySim::CalculateTagBits() {
-    // Calculate Tag
-    tag = log2((mainMemorySize/cacheSize)*mappingAssociation);
+    // Calculate Tag (Same as the Cache Engine: address lines - log2(cache size / N))
+    tag = (int)floor(GetAddressBits(mainMemorySize) - log2(cacheSize) + log2(mappingAssociation));
+    tag = max(tag, 0);
 }
 
 /****************************************************************************************
@@ -541,31 +1186,155 @@ void MemorySim::CalculateTotalCacheSize() {
 }
 
 /****************************************************************************************
- * Function Name:       MakeBinaryTag
- * Input Parameters:    int - represents the main memory address in decimal 
- * Return Value:        string - represents the binary tag as a string of 1's and 0's
- * Purpose:             Calculates the tag in decimal then converts the decimal tag
- *                      into a binary version. Returns the binary tag as a string.
+ * Function Name:       RunMemorySequenceSharded
+ * Input Parameters:    void
+ * Return Value:        void
+ * Purpose:             Multi-threaded version of RunMemorySequence. Each thread owns 
+ *                      every threads-th cache set in its own shard Cache Engine and 
+ *                      performs, in order, only the rows that map to its sets (dealt
+ *                      out to the shards in one pass before the threads start). Each
+ *                      set still sees its accesses in file order, so every hit/miss 
+ *                      and every final cache line matches the serial run. When all
+ *                      threads are done, the shards are merged into the Cache Table 
+ *                      and the hit rows into the Address Table in shard order.
  ***************************************************************************************/
-string MemorySim::MakeBinaryTag(int address) {
-    // Declare temporary String variable
-    string temp = "";
-    
-    // Get Tag from Address
-    for(int i=0; i < (offset + index); i++) {
-        // Shift Right
-        address = address / 2;
+void MemorySim::RunMemorySequenceSharded() {
+    // No more shards than cache sets
+    int shards = min(threads, cacheEngine.GetCacheSets());
+
+    // Count the rows of each shard (The set comes from the full engine's shifts and
+    // masks; sets are dealt out round-robin)
+    int rows = addressSequenceTable.GetSize();
+    vector<int> shardSizes(shards, 0);
+    for(int i=0; i < rows; i++) {
+        shardSizes[cacheEngine.GetCMSet(addressSequenceTable.GetMMAddress(i)) % shards]++;
+    }
+
+    // Deal out the rows, in order, to their shards
+    vector<vector<int>> shardRows(shards);
+    for(int k=0; k < shards; k++) {
+        shardRows[k].reserve(shardSizes[k]);
     }
+    for(int i=0; i < rows; i++) {
+        shardRows[cacheEngine.GetCMSet(addressSequenceTable.GetMMAddress(i)) % shards].push_back(i);
+    }
+
+    // Shard Engines and the rows each shard found to be hits
+    vector<CacheEngine> shardEngines(shards);
+    vector<vector<int>> hitRows(shards);
+    vector<thread> workers;
+
+    // Start one Worker Thread per shard
+    for(int k=0; k < shards; k++) {
+        shardEngines[k].SetShard(mainMemorySize, cacheSize, blockSize, mappingAssociation,
+                replacementPolicy, k, shards);
+        shardEngines[k].SetWritePolicy(writeBack, writeAllocate, 0);
+        workers.push_back(thread(&MemorySim::ShardWorker, this, &shardEngines[k], &shardRows[k],
+                &hitRows[k]));
+    }
+
+    // Wait for all shards, then merge them in order
+    for(int k=0; k < shards; k++) {
+        workers[k].join();
+    }
+    for(int k=0; k < shards; k++) {
+        // Merge shard's sets into the Cache Table
+        cacheEngine.MergeShard(shardEngines[k]);
+
+        // Set Hits on Address Table
+        for(int i=0; i < (int)hitRows[k].size(); i++) {
+            addressSequenceTable.SetHit(hitRows[k][i]);
+        }
+    }
+}
+
+/****************************************************************************************
+ * Function Name:       ShardWorker
+ * Input Parameters:    CacheEngine* shardEngine - represents the shard's engine
+ *                      vector<int>* rows - represents the shard's rows, in order
+ *                      vector<int>* hitRows - filled with rows that were hits
+ * Return Value:        void
+ * Purpose:             Body of a shard's thread. Performs, in order, every row of the
+ *                      Address Table whose cache set belongs to the shard. The 
+ *                      Address Table is only read here; hits are recorded in hitRows
+ *                      and set on the table after all threads are done.
+ ***************************************************************************************/
+void MemorySim::ShardWorker(CacheEngine* shardEngine, vector<int>* rows, vector<int>* hitRows) {
+    // At most every row of the shard is a hit
+    hitRows->reserve(rows->size());
+
+    // Chunk of Memory Accesses and their results
+    vector<TraceRecord> chunk;
+    vector<AccessResult> results;
+    chunk.reserve(ACCESS_CHUNK_SIZE);
+
+    // For each chunk of lines of Sequence Table that map to this shard's sets
+    for(int first=0; first < (int)rows->size(); first += ACCESS_CHUNK_SIZE) {
+        // Gather the chunk's rows
+        int last = min(first + ACCESS_CHUNK_SIZE, (int)rows->size());
+        chunk.clear();
+        for(int j = first; j < last; j++) {
+            chunk.push_back(addressSequenceTable.GetRecord((*rows)[j]));
+        }
 
-    // Convert Tag to Binary
-    for(int i=0; i < tag; i++) {
-        // Combine lsb and temp string
-        temp = to_string(address % 2) + temp;
+        // Access the shard and record Hits
+        shardEngine->AccessChunk(chunk, results);
+        for(int j = first; j < last; j++) {
+            if(results[j - first].hit) {
+                hitRows->push_back((*rows)[j]);
+            }
+        }
+    }
+}
 
-        // Shift Right 
-        address = address / 2;
+/****************************************************************************************
+ * Function Name:       PrintThroughput
+ * Input Parameters:    string label - represents the name of the measurement
+ *                      long long bytes - represents the number of bytes processed
+ *                      chrono::steady_clock::time_point startTime - represents when
+ *                      processing started
+ *                      chrono::steady_clock::time_point endTime - represents when
+ *                      processing stopped (defaults to now)
+ * Return Value:        void
+ * Purpose:             Prints how many megabytes of the trace file were processed per
+ *                      second between startTime and endTime. A generated trace has no
+ *                      file, so only the time is printed.
+ ***************************************************************************************/
+void MemorySim::PrintThroughput(string label, long long bytes, 
+        chrono::steady_clock::time_point startTime,
+        chrono::steady_clock::time_point endTime) {
+    // Calculate elapsed seconds
+    chrono::duration<double> elapsed = endTime - startTime;
+
+    // Generated Trace: no bytes were read
+    if(bytes == 0) {
+        cout << endl << label << " = generated trace in " << elapsed.count() << " s" << endl;
+        return;
     }
 
-    // Return temp string
-    return temp;
+    // Calculate Megabytes per second (guard against a zero elapsed time)
+    double megabytes = (double)bytes / 1000000.0;
+    double throughput = megabytes / max(elapsed.count(), 1e-9);
+
+    // Print Throughput
+    cout << endl << label << " = " << megabytes << " MB in " << elapsed.count();
+    cout << " s = " << throughput << " MB/s" << endl;
+}
+
+/****************************************************************************************
+ * Function Name:       ReadMainMemorySize
+ * Input Parameters:    void
+ * Return Value:        void
+ * Purpose:             Reads the main memory size as a number or as "2^N", so 64-bit
+ *                      address spaces up to 2^64 bytes can be entered. Asks again
+ *                      until the size is valid.
+ ***************************************************************************************/
+void MemorySim::ReadMainMemorySize() {
+    // Temporary Variable for the typed size
+    string text;
+
+    // Read until valid (or until the input ends)
+    while((cin >> text) && !ParseMemorySize(text, mainMemorySize)) {
+        cout << "Invalid size, enter a number or 2^N (N up to 64): ";
+    }
 }
\ No newline at end of file
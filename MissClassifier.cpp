@@ -0,0 +1,324 @@
+/****************************************************************************************
+ *  Memory Simulator: "MissClassifier.cpp"
+ *
+ *  Author:     Hannah Perkins
+ *  CWID:       11472559
+ *  Assignment: Lab #7
+ *
+ *  Date:       17 October 2026
+ *  Course:     ECE 487
+ *
+ *  Function:   Sorts cache misses into compulsory, capacity, and conflict misses
+ *
+ *  Description: Miss Classifier Class that sees the same memory accesses as the Cache
+ *          Engine, along with whether each one hit, and explains every miss (the
+ *          "3C" model):
+ *
+ *              Compulsory  - first access to the block; no cache could hit.
+ *              Capacity    - a fully associative LRU cache with the same number of
+ *                            lines would also have missed.
+ *              Conflict    - the fully associative LRU cache would have hit, so the
+ *                            miss was caused by the mapping.
+ *
+ *          The fully associative "shadow" cache is kept as a doubly-linked list of
+ *          cache lines in LRU order, stored as next/previous line numbers inside
+ *          vectors, plus a BlockMap from block number to line number. Finding,
+ *          moving, and evicting a block are all O(1), so classifying a trace adds
+ *          only a constant amount of work per access.
+ *
+ ***************************************************************************************/
+
+#ifndef MISSCLASSIFIER_CPP
+#define MISSCLASSIFIER_CPP
+
+#include "Address.h"
+#include "BlockSet.h"
+#include "BlockMap.h"
+#include <iostream>
+#include <string>
+#include <vector>
+using namespace std;
+
+// Marks the end of the shadow cache's LRU list
+const int NO_LINE = -1;
+
+/****************************************************************************************
+ * Class Name:          MissClassifier
+ * Purpose:             Classifies each cache miss as compulsory, capacity, or conflict
+ ***************************************************************************************/
+class MissClassifier {
+    public:
+        MissClassifier();                           // Constructor
+
+        // User Functions
+        void SetClassifier(int cacheSize, int blockSize);
+        void Access(Address address, bool hit);
+        void Print();
+
+        // Getter Functions
+        long long GetCompulsoryMisses();
+        long long GetUniqueBlocks();
+        long long GetCapacityMisses();
+        long long GetConflictMisses();
+
+    private:
+        // Variables Set by User
+        int blockSize;
+        int cacheLines;
+
+        // Blocks accessed so far
+        BlockSet touchedBlocks;
+
+        // Shadow Fully Associative LRU Cache (head = most recently used)
+        BlockMap lineOf;
+        vector<long long> lineBlock;                // Read only once the line is used
+        vector<int> nextLine;
+        vector<int> previousLine;
+        int head;
+        int tail;
+        int usedLines;
+
+        // Counters
+        long long totalAccesses;
+        long long compulsoryMisses;
+        long long capacityMisses;
+        long long conflictMisses;
+
+        // Helper Functions
+        bool AccessShadow(long long block);
+        void Unlink(int line);
+        void PushFront(int line);
+        void PrintRate(string label, long long count);
+};
+
+/****************************************************************************************
+ * Constructor
+ ***************************************************************************************/
+MissClassifier::MissClassifier() {
+    // Nothing accessed yet
+    SetClassifier(0, 1);
+}
+
+/****************************************************************************************
+ * Function Name:       SetClassifier
+ * Input Parameters:    int cacheSize - represents the size of the cache in bytes
+ *                      int blockSize - represents the block size in bytes
+ * Return Value:        void
+ * Purpose:             Creates an empty shadow cache with as many lines as the real
+ *                      cache and resets the counters
+ ***************************************************************************************/
+void MissClassifier::SetClassifier(int cacheSize, int blockSize) {
+    // Store User Settings
+    this->blockSize = blockSize;
+    cacheLines = cacheSize / blockSize;
+
+    // Empty Shadow Cache
+    touchedBlocks.Clear();
+    lineOf.Clear();
+    lineBlock.assign(cacheLines, 0);
+    nextLine.assign(cacheLines, NO_LINE);
+    previousLine.assign(cacheLines, NO_LINE);
+    head = NO_LINE;
+    tail = NO_LINE;
+    usedLines = 0;
+
+    // Reset Counters
+    totalAccesses = 0;
+    compulsoryMisses = 0;
+    capacityMisses = 0;
+    conflictMisses = 0;
+}
+
+/****************************************************************************************
+ * Function Name:       Access
+ * Input Parameters:    Address address - represents the main memory address accessed
+ *                      bool hit - represents whether the real cache hit
+ * Return Value:        void
+ * Purpose:             Updates the shadow cache with the access and, if the real
+ *                      cache missed, counts the miss under its cause
+ ***************************************************************************************/
+void MissClassifier::Access(Address address, bool hit) {
+    // Main Memory Block Number = Main Memory Address / Block Size
+    long long block = address / blockSize;
+
+    // Count the access
+    totalAccesses++;
+
+    // First touch and shadow cache are updated on every access
+    bool firstTouch = touchedBlocks.Insert(block);
+    bool shadowHit = AccessShadow(block);
+
+    // Classify the miss
+    if(!hit) {
+        if(firstTouch) {
+            compulsoryMisses++;
+        }
+        else if(!shadowHit) {
+            capacityMisses++;
+        }
+        else {
+            conflictMisses++;
+        }
+    }
+}
+
+/****************************************************************************************
+ * Function Name:       Print
+ * Input Parameters:    void
+ * Return Value:        void
+ * Purpose:             Prints the number of each kind of miss and its rate out of all
+ *                      memory accesses
+ ***************************************************************************************/
+void MissClassifier::Print() {
+    // Print each kind of miss
+    PrintRate("Compulsory miss rate", compulsoryMisses);
+    PrintRate("Capacity miss rate", capacityMisses);
+    PrintRate("Conflict miss rate", conflictMisses);
+}
+
+/****************************************************************************************
+ * Function Name:       GetCompulsoryMisses
+ * Input Parameters:    void
+ * Return Value:        long long - represents the number of compulsory misses
+ * Purpose:             Returns the number of misses on a block's first access
+ ***************************************************************************************/
+long long MissClassifier::GetCompulsoryMisses() {
+    // Return compulsoryMisses
+    return compulsoryMisses;
+}
+
+/****************************************************************************************
+ * Function Name:       GetUniqueBlocks
+ * Input Parameters:    void
+ * Return Value:        long long - represents the number of unique blocks accessed
+ * Purpose:             Returns the number of main memory blocks accessed at least
+ *                      once, which is the number of misses no cache could avoid
+ ***************************************************************************************/
+long long MissClassifier::GetUniqueBlocks() {
+    // Every block accessed is in touchedBlocks once
+    return touchedBlocks.GetSize();
+}
+
+/****************************************************************************************
+ * Function Name:       GetCapacityMisses
+ * Input Parameters:    void
+ * Return Value:        long long - represents the number of capacity misses
+ * Purpose:             Returns the number of misses a fully associative cache of the
+ *                      same size would also have had
+ ***************************************************************************************/
+long long MissClassifier::GetCapacityMisses() {
+    // Return capacityMisses
+    return capacityMisses;
+}
+
+/****************************************************************************************
+ * Function Name:       GetConflictMisses
+ * Input Parameters:    void
+ * Return Value:        long long - represents the number of conflict misses
+ * Purpose:             Returns the number of misses caused by the cache's mapping
+ ***************************************************************************************/
+long long MissClassifier::GetConflictMisses() {
+    // Return conflictMisses
+    return conflictMisses;
+}
+
+/****************************************************************************************
+ * Function Name:       AccessShadow
+ * Input Parameters:    long long - represents the main memory block number
+ * Return Value:        bool - represents whether the shadow cache hit (1) or not (0)
+ * Purpose:             Accesses the fully associative LRU shadow cache. A hit moves
+ *                      the line to the front of the LRU list. A miss fills an unused
+ *                      line, or evicts the line at the back of the list.
+ ***************************************************************************************/
+bool MissClassifier::AccessShadow(long long block) {
+    // No lines, nothing can hit
+    if(cacheLines == 0) {
+        return false;
+    }
+
+    // Case 1: Block is in the shadow cache, make it most recently used
+    int line = lineOf.Find(block);
+    if(line != NO_LINE) {
+        Unlink(line);
+        PushFront(line);
+        return true;
+    }
+
+    // Case 2: Use an unused line
+    if(usedLines < cacheLines) {
+        line = usedLines;
+        usedLines++;
+    }
+    // Case 3: Evict the least recently used line
+    else {
+        line = tail;
+        lineOf.Erase(lineBlock[line]);
+        Unlink(line);
+    }
+
+    // Place block in line as most recently used
+    lineBlock[line] = block;
+    lineOf.Insert(block, line);
+    PushFront(line);
+
+    return false;
+}
+
+/****************************************************************************************
+ * Function Name:       Unlink
+ * Input Parameters:    int - represents the shadow cache line
+ * Return Value:        void
+ * Purpose:             Removes the line from the LRU list
+ ***************************************************************************************/
+void MissClassifier::Unlink(int line) {
+    // Point neighbors at each other (or move head/tail)
+    if(previousLine[line] != NO_LINE) {
+        nextLine[previousLine[line]] = nextLine[line];
+    }
+    else {
+        head = nextLine[line];
+    }
+    if(nextLine[line] != NO_LINE) {
+        previousLine[nextLine[line]] = previousLine[line];
+    }
+    else {
+        tail = previousLine[line];
+    }
+}
+
+/****************************************************************************************
+ * Function Name:       PushFront
+ * Input Parameters:    int - represents the shadow cache line
+ * Return Value:        void
+ * Purpose:             Adds the line to the front (most recently used end) of the
+ *                      LRU list
+ ***************************************************************************************/
+void MissClassifier::PushFront(int line) {
+    // Line goes before the current head
+    previousLine[line] = NO_LINE;
+    nextLine[line] = head;
+    if(head != NO_LINE) {
+        previousLine[head] = line;
+    }
+    else {
+        tail = line;
+    }
+    head = line;
+}
+
+/****************************************************************************************
+ * Function Name:       PrintRate
+ * Input Parameters:    string label - represents the name of the kind of miss
+ *                      long long count - represents the number of misses
+ * Return Value:        void
+ * Purpose:             Prints "label = count/total accesses = rate%"
+ ***************************************************************************************/
+void MissClassifier::PrintRate(string label, long long count) {
+    // Calculate rate out of all accesses
+    double rate = 100.0 * ((double)count / (double)totalAccesses);
+
+    // Print Rate
+    cout << label << " = " << count << "/" << totalAccesses << " = " << rate << "%" << endl;
+}
+
+#endif
\ No newline at end of file
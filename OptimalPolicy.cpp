@@ -0,0 +1,45 @@
+/****************************************************************************************
+ *  Memory Simulator: "OptimalPolicy.cpp"
+ *
+ *  Author:     Hannah Perkins
+ *  CWID:       11472559
+ *  Assignment: Lab #7
+ *
+ *  Date:       17 October 2026
+ *  Course:     ECE 487
+ *
+ *  Function:   Chooses the optimal (Belady/MIN) line to replace in a cache set
+ *
+ *  Description: Defines the OptimalPolicy functions used when a cache is set up. The
+ *          heap functions called on every access are inline in "OptimalPolicy.h".
+ *
+ ***************************************************************************************/
+
+#include "OptimalPolicy.h"
+using namespace std;
+
+/****************************************************************************************
+ * Constructor
+ ***************************************************************************************/
+OptimalPolicy::OptimalPolicy() {
+    // No sets yet
+    mappingAssociation = 1;
+}
+
+/****************************************************************************************
+ * Function Name:       SetPolicy
+ * Input Parameters:    int cacheLines - represents the number of lines in the table
+ *                      int mappingAssociation - represents the N of N-way mapping
+ * Return Value:        void
+ * Purpose:             Creates an empty heap for every set of the Cache Table
+ ***************************************************************************************/
+void OptimalPolicy::SetPolicy(int cacheLines, int mappingAssociation) {
+    // Store User Settings
+    this->mappingAssociation = mappingAssociation;
+
+    // Every line empty, every heap empty
+    nextUseOf.assign(cacheLines, NO_NEXT_USE);
+    position.assign(cacheLines, -1);
+    heap.assign(cacheLines, 0);
+    heapSize.assign(cacheLines / mappingAssociation, 0);
+}
\ No newline at end of file
@@ -0,0 +1,206 @@
+/****************************************************************************************
+ *  Memory Simulator: "OptimalPolicy.h"
+ *
+ *  Author:     Hannah Perkins
+ *  CWID:       11472559
+ *  Assignment: Lab #7
+ *
+ *  Date:       17 October 2026
+ *  Course:     ECE 487
+ *
+ *  Function:   Chooses the optimal (Belady/MIN) line to replace in a cache set
+ *
+ *  Description: Optimal Policy Class used by the Cache Engine for OPT replacement.
+ *          Belady's MIN policy evicts the line whose block is used again farthest in
+ *          the future, which gives the highest hit rate any replacement policy can
+ *          reach. The next use of every access is found beforehand by the Address
+ *          Table (one backward pass over the trace).
+ *
+ *          Each set keeps a max-heap of its lines ordered by the next use of the
+ *          block in the line. The heap of the set starting at cache line f is stored
+ *          in heap[f] to heap[f + N - 1], and each line remembers its position in the
+ *          heap, so updating a line after a hit and finding the line to evict are
+ *          both O(log N) for an N-way set.
+ *
+ *          The class has the same functions as the policies in 
+ *          "ReplacementPolicy.h", so the Cache Engine uses it the same way.
+ *
+ ***************************************************************************************/
+
+#ifndef OPTIMALPOLICY_H
+#define OPTIMALPOLICY_H
+
+#include <vector>
+#include <climits>
+using namespace std;
+
+// Next use of a block that is never accessed again
+const int NO_NEXT_USE = INT_MAX;
+
+/****************************************************************************************
+ * Class Name:          OptimalPolicy
+ * Purpose:             Keeps one next-use max-heap per cache set for OPT replacement
+ ***************************************************************************************/
+class OptimalPolicy {
+    public:
+        OptimalPolicy();                            // Constructor
+
+        // Policy Functions
+        void SetPolicy(int cacheLines, int mappingAssociation);
+        void Hit(int line, int nextUse);
+        void Fill(int line, int nextUse);
+        int GetVictim(int firstLine);
+
+    private:
+        // Variables Set by User
+        int mappingAssociation;
+
+        // Per Line: next use of its block, and its position in the set's heap (-1 if
+        // the line is empty)
+        vector<int> nextUseOf;
+        vector<int> position;
+
+        // Per Set: heap of lines (stored in the set's own line range) and heap size
+        vector<int> heap;
+        vector<int> heapSize;
+
+        // Helper Functions
+        void Touch(int line, int nextUse);
+        void SiftUp(int firstLine, int slot);
+        void SiftDown(int firstLine, int slot);
+        void Swap(int firstLine, int a, int b);
+};
+
+/****************************************************************************************
+ * Function Name:       Hit
+ * Input Parameters:    int line - represents the cache line accessed
+ *                      int nextUse - represents the row of the block's next access
+ * Return Value:        void
+ * Purpose:             Stores the block's new next use
+ ***************************************************************************************/
+inline void OptimalPolicy::Hit(int line, int nextUse) {
+    // Move line to its new place in the heap
+    Touch(line, nextUse);
+}
+
+/****************************************************************************************
+ * Function Name:       Fill
+ * Input Parameters:    int line - represents the cache line filled
+ *                      int nextUse - represents the row of the block's next access
+ * Return Value:        void
+ * Purpose:             Stores the new block's next use
+ ***************************************************************************************/
+inline void OptimalPolicy::Fill(int line, int nextUse) {
+    // Add line to the heap or move it to its new place
+    Touch(line, nextUse);
+}
+
+/****************************************************************************************
+ * Function Name:       GetVictim
+ * Input Parameters:    int - represents the first line of a full set
+ * Return Value:        int - represents the line to replace
+ * Purpose:             Returns the line whose block is used again farthest in the
+ *                      future (the top of the set's heap)
+ ***************************************************************************************/
+inline int OptimalPolicy::GetVictim(int firstLine) {
+    // Top of the max-heap
+    return heap[firstLine];
+}
+
+/****************************************************************************************
+ * Function Name:       Touch
+ * Input Parameters:    int line - represents the cache line that was accessed/filled
+ *                      int nextUse - represents the row of the block's next access
+ * Return Value:        void
+ * Purpose:             Stores the next use of the block now in line. An empty line
+ *                      is added to its set's heap; otherwise the line moves to its
+ *                      new place in the heap.
+ ***************************************************************************************/
+inline void OptimalPolicy::Touch(int line, int nextUse) {
+    // First line of the set the line belongs to
+    int firstLine = line - (line % mappingAssociation);
+    int set = line / mappingAssociation;
+
+    // Add line to the end of the heap if it was empty
+    if(position[line] < 0) {
+        position[line] = heapSize[set];
+        heap[firstLine + heapSize[set]] = line;
+        heapSize[set]++;
+    }
+
+    // Store next use and restore heap order (Key can move either way)
+    nextUseOf[line] = nextUse;
+    SiftUp(firstLine, position[line]);
+    SiftDown(firstLine, position[line]);
+}
+
+/****************************************************************************************
+ * Function Name:       SiftUp
+ * Input Parameters:    int firstLine - represents the first line of the set
+ *                      int slot - represents the heap position to move up
+ * Return Value:        void
+ * Purpose:             Swaps the line at slot with its parent while it is used later
+ *                      than its parent
+ ***************************************************************************************/
+inline void OptimalPolicy::SiftUp(int firstLine, int slot) {
+    // Move up while larger than parent
+    while(slot > 0) {
+        int parent = (slot - 1) / 2;
+        if(nextUseOf[heap[firstLine + slot]] <= nextUseOf[heap[firstLine + parent]]) {
+            break;
+        }
+        Swap(firstLine, slot, parent);
+        slot = parent;
+    }
+}
+
+/****************************************************************************************
+ * Function Name:       SiftDown
+ * Input Parameters:    int firstLine - represents the first line of the set
+ *                      int slot - represents the heap position to move down
+ * Return Value:        void
+ * Purpose:             Swaps the line at slot with its larger child while a child is
+ *                      used later than it
+ ***************************************************************************************/
+inline void OptimalPolicy::SiftDown(int firstLine, int slot) {
+    // Number of lines in the set's heap
+    int count = heapSize[firstLine / mappingAssociation];
+
+    // Move down while a child is larger
+    while(true) {
+        int largest = slot;
+        int left = (2 * slot) + 1;
+        int right = left + 1;
+        if((left < count) && (nextUseOf[heap[firstLine + left]] > nextUseOf[heap[firstLine + largest]])) {
+            largest = left;
+        }
+        if((right < count) && (nextUseOf[heap[firstLine + right]] > nextUseOf[heap[firstLine + largest]])) {
+            largest = right;
+        }
+        if(largest == slot) {
+            break;
+        }
+        Swap(firstLine, slot, largest);
+        slot = largest;
+    }
+}
+
+/****************************************************************************************
+ * Function Name:       Swap
+ * Input Parameters:    int firstLine - represents the first line of the set
+ *                      int a, int b - represent two heap positions of the set
+ * Return Value:        void
+ * Purpose:             Swaps two lines of a set's heap and updates their positions
+ ***************************************************************************************/
+inline void OptimalPolicy::Swap(int firstLine, int a, int b) {
+    // Swap lines
+    int temp = heap[firstLine + a];
+    heap[firstLine + a] = heap[firstLine + b];
+    heap[firstLine + b] = temp;
+
+    // Update positions
+    position[heap[firstLine + a]] = a;
+    position[heap[firstLine + b]] = b;
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,165 @@
+/****************************************************************************************
+ *  Memory Simulator: "ReplacementPolicy.cpp"
+ *
+ *  Author:     Hannah Perkins
+ *  CWID:       11472559
+ *  Assignment: Lab #7
+ *
+ *  Date:       17 October 2026
+ *  Course:     ECE 487
+ *
+ *  Function:   Defines the replacement policies the Cache Engine can use
+ *
+ *  Description: Defines the policy-letter and policy-name functions and the SetPolicy
+ *          function of every policy class except the RRIP template. Hit, Fill, and
+ *          GetVictim are inline in "ReplacementPolicy.h" so the Cache Engine's
+ *          access loop can inline them.
+ *
+ ***************************************************************************************/
+
+#include "ReplacementPolicy.h"
+#include <ctype.h>
+using namespace std;
+
+/****************************************************************************************
+ * Function Name:       ParsePolicy
+ * Input Parameters:    char - represents the policy letter chosen by the user
+ * Return Value:        int - represents the replacement policy
+ * Purpose:             Converts L, F, O, P, S, B, R, or U into a replacement policy.
+ *                      Any other letter is FIFO, as it always has been.
+ ***************************************************************************************/
+int ParsePolicy(char letter) {
+    // Match letter to policy
+    switch(letter) {
+        case 'L': return LRU_POLICY;
+        case 'O': return OPT_POLICY;
+        case 'P': return PLRU_POLICY;
+        case 'S': return SRRIP_POLICY;
+        case 'B': return BRRIP_POLICY;
+        case 'R': return RANDOM_POLICY;
+        case 'U': return LFU_POLICY;
+        default:  return FIFO_POLICY;
+    }
+}
+
+/****************************************************************************************
+ * Function Name:       ParsePolicyName
+ * Input Parameters:    string - represents a policy letter or name (any case)
+ * Return Value:        int - represents the replacement policy, or -1 if the text is
+ *                      not a policy
+ * Purpose:             Converts a policy letter (L, F, O, P, S, B, R, or U) or a name
+ *                      printed by GetPolicyName ("LRU", "PLRU", ...) into a policy.
+ *                      Unlike ParsePolicy, unknown text is not taken as FIFO.
+ ***************************************************************************************/
+int ParsePolicyName(string name) {
+    // Compare in upper case
+    for(int i=0; i < (int)name.length(); i++) {
+        name[i] = toupper(name[i]);
+    }
+
+    // Single Letter
+    string letters = "LFOPSBRU";
+    if(name.length() == 1) {
+        return (letters.find(name[0]) != string::npos) ? ParsePolicy(name[0]) : -1;
+    }
+
+    // Full Name
+    for(int policy = LRU_POLICY; policy <= LFU_POLICY; policy++) {
+        string policyName = GetPolicyName(policy);
+        for(int i=0; i < (int)policyName.length(); i++) {
+            policyName[i] = toupper(policyName[i]);
+        }
+        if(name == policyName) {
+            return policy;
+        }
+    }
+
+    return -1;
+}
+
+/****************************************************************************************
+ * Function Name:       GetPolicyName
+ * Input Parameters:    int - represents the replacement policy
+ * Return Value:        string - represents the policy's name
+ * Purpose:             Returns the name printed for a replacement policy
+ ***************************************************************************************/
+string GetPolicyName(int policy) {
+    // Match policy to name
+    switch(policy) {
+        case LRU_POLICY:    return "LRU";
+        case OPT_POLICY:    return "OPT";
+        case PLRU_POLICY:   return "PLRU";
+        case SRRIP_POLICY:  return "SRRIP";
+        case BRRIP_POLICY:  return "BRRIP";
+        case RANDOM_POLICY: return "Random";
+        case LFU_POLICY:    return "LFU";
+        default:            return "FIFO";
+    }
+}
+
+/****************************************************************************************
+ * Function Name:       SetPolicy
+ * Input Parameters:    int cacheLines - represents the number of lines in the table
+ *                      int mappingAssociation - represents the N of N-way mapping
+ * Return Value:        void
+ * Purpose:             Sets every line's time clock and the virtual clock to 0
+ ***************************************************************************************/
+void LRUPolicy::SetPolicy(int cacheLines, int mappingAssociation) {
+    // Store User Settings and reset clocks
+    this->mappingAssociation = mappingAssociation;
+    virtualClock = 0;
+    timeClock.assign(cacheLines, 0);
+}
+
+/****************************************************************************************
+ * Function Name:       SetPolicy
+ * Input Parameters:    int cacheLines - represents the number of lines in the table
+ *                      int mappingAssociation - represents the N of N-way mapping
+ * Return Value:        void
+ * Purpose:             Sets every line's time clock and the virtual clock to 0
+ ***************************************************************************************/
+void FIFOPolicy::SetPolicy(int cacheLines, int mappingAssociation) {
+    // Store User Settings and reset clocks
+    this->mappingAssociation = mappingAssociation;
+    virtualClock = 0;
+    timeClock.assign(cacheLines, 0);
+}
+
+/****************************************************************************************
+ * Function Name:       SetPolicy
+ * Input Parameters:    int cacheLines - represents the number of lines in the table
+ *                      int mappingAssociation - represents the N of N-way mapping
+ * Return Value:        void
+ * Purpose:             Clears every tree bit (every tree points at way 0)
+ ***************************************************************************************/
+void TreePLRUPolicy::SetPolicy(int cacheLines, int mappingAssociation) {
+    // Store User Settings and clear bits
+    this->mappingAssociation = mappingAssociation;
+    treeBits.assign(cacheLines, 0);
+}
+
+/****************************************************************************************
+ * Function Name:       SetPolicy
+ * Input Parameters:    int cacheLines - represents the number of lines in the table
+ *                      int mappingAssociation - represents the N of N-way mapping
+ * Return Value:        void
+ * Purpose:             Seeds every set's generator
+ ***************************************************************************************/
+void RandomPolicy::SetPolicy(int cacheLines, int mappingAssociation) {
+    // Store User Settings and seed generators
+    this->mappingAssociation = mappingAssociation;
+    randomState.assign(cacheLines / mappingAssociation, RANDOM_SEED);
+}
+
+/****************************************************************************************
+ * Function Name:       SetPolicy
+ * Input Parameters:    int cacheLines - represents the number of lines in the table
+ *                      int mappingAssociation - represents the N of N-way mapping
+ * Return Value:        void
+ * Purpose:             Sets every line's use count to 0
+ ***************************************************************************************/
+void LFUPolicy::SetPolicy(int cacheLines, int mappingAssociation) {
+    // Store User Settings and reset counts
+    this->mappingAssociation = mappingAssociation;
+    useCount.assign(cacheLines, 0);
+}
\ No newline at end of file
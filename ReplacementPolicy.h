@@ -0,0 +1,642 @@
+/****************************************************************************************
+ *  Memory Simulator: "ReplacementPolicy.h"
+ *
+ *  Author:     Hannah Perkins
+ *  CWID:       11472559
+ *  Assignment: Lab #7
+ *
+ *  Date:       17 October 2026
+ *  Course:     ECE 487
+ *
+ *  Function:   Defines the replacement policies the Cache Engine can use
+ *
+ *  Description: Each replacement policy is a class with the same four functions:
+ *
+ *              SetPolicy(cacheLines, N)    creates the policy's state for every line
+ *              Hit(line, nextUse)          the block in line was accessed again
+ *              Fill(line, nextUse)         a new block was placed in line
+ *              GetVictim(firstLine)        returns the line of a full set to replace
+ *
+ *          The Cache Engine's access loop is a template over the policy class, so
+ *          every policy gets its own compiled copy of the loop with these functions
+ *          inlined, and no check of the chosen policy is made per cache line.
+ *          nextUse is only used by OPT (see "OptimalPolicy.h").
+ *
+ *              LRU, FIFO, and LFU pick the way with the lowest time clock or use
+ *          count through FindLowestWay, which compares several ways per
+ *          instruction in wide sets (see "WayProbe.h").
+ *
+ *              A fully associative cache (one set) with LRU or FIFO uses
+ *          LRUListPolicy or FIFOListPolicy instead, which keep every line in a
+ *          doubly linked list in the order the time clocks would sort them. A hit,
+ *          fill, or victim is then a few pointer updates, however many lines the
+ *          cache has.
+ *
+ *              LRU         - evicts the line used longest ago
+ *              FIFO        - evicts the line filled longest ago
+ *              Tree PLRU   - a binary tree of N - 1 bits per set points toward the
+ *                            victim; each access turns the bits on its path away
+ *                            from it (N must be a power of two)
+ *              SRRIP       - each line holds a 2-bit re-reference prediction value
+ *                            (RRPV). Hits set it to 0, fills to 2, and the first
+ *                            line at 3 is evicted after aging the set
+ *              BRRIP       - SRRIP, but fills are predicted distant (3) except for
+ *                            1 in 32, so lines only stay once they are reused
+ *              Random      - evicts a random line
+ *              LFU         - evicts the line with the fewest accesses since it was
+ *                            filled (ties go to the lowest line)
+ *
+ *          Random numbers come from one xorshift generator per set, all starting
+ *          from the same seed. A set's choices then depend only on the accesses to
+ *          that set, so sharded and serial runs give identical results.
+ *
+ ***************************************************************************************/
+
+#ifndef REPLACEMENTPOLICY_H
+#define REPLACEMENTPOLICY_H
+
+#include "OptimalPolicy.h"
+#include "WayProbe.h"
+#include <string>
+#include <vector>
+using namespace std;
+
+// Replacement Policies
+const int LRU_POLICY = 0;
+const int FIFO_POLICY = 1;
+const int OPT_POLICY = 2;
+const int PLRU_POLICY = 3;
+const int SRRIP_POLICY = 4;
+const int BRRIP_POLICY = 5;
+const int RANDOM_POLICY = 6;
+const int LFU_POLICY = 7;
+
+// Policies the Cache Engine runs in place of LRU and FIFO for a fully associative
+// cache (Never chosen by the user)
+const int LRU_LIST_POLICY = 8;
+const int FIFO_LIST_POLICY = 9;
+
+// Largest re-reference prediction value of SRRIP and BRRIP (2 bits)
+const unsigned char RRPV_MAX = 3;
+
+// Seed of every set's random number generator
+const unsigned int RANDOM_SEED = 2463534242u;
+
+// Policy Letters and Names
+int ParsePolicy(char letter);
+int ParsePolicyName(string name);
+string GetPolicyName(int policy);
+
+/****************************************************************************************
+ * Function Name:       NextRandom
+ * Input Parameters:    unsigned int& - represents a generator's state
+ * Return Value:        unsigned int - represents the next random number
+ * Purpose:             Advances a 32-bit xorshift generator and returns its output
+ ***************************************************************************************/
+inline unsigned int NextRandom(unsigned int &state) {
+    // Shift and xor three times
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return state;
+}
+
+/****************************************************************************************
+ * Class Name:          LRUPolicy
+ * Purpose:             Evicts the least recently used line of a set
+ ***************************************************************************************/
+class LRUPolicy {
+    public:
+        // Policy Functions
+        void SetPolicy(int cacheLines, int mappingAssociation);
+        void Hit(int line, int nextUse);
+        void Fill(int line, int nextUse);
+        int GetVictim(int firstLine);
+
+    private:
+        // Variables Set by User
+        int mappingAssociation;
+
+        // Time Variables (Virtual clock counts accesses, timeClock is each line's last)
+        long long virtualClock;
+        vector<long long> timeClock;
+};
+
+/****************************************************************************************
+ * Function Name:       Hit
+ * Input Parameters:    int line - represents the cache line accessed
+ *                      int nextUse - not used
+ * Return Value:        void
+ * Purpose:             Makes the line the most recently used of its set
+ ***************************************************************************************/
+inline void LRUPolicy::Hit(int line, int nextUse) {
+    // Set time clock at line to the incremented virtual clock
+    virtualClock++;
+    timeClock[line] = virtualClock;
+}
+
+/****************************************************************************************
+ * Function Name:       Fill
+ * Input Parameters:    int line - represents the cache line filled
+ *                      int nextUse - not used
+ * Return Value:        void
+ * Purpose:             Makes the new line the most recently used of its set
+ ***************************************************************************************/
+inline void LRUPolicy::Fill(int line, int nextUse) {
+    // Set time clock at line to the incremented virtual clock
+    virtualClock++;
+    timeClock[line] = virtualClock;
+}
+
+/****************************************************************************************
+ * Function Name:       GetVictim
+ * Input Parameters:    int - represents the first line of a full set
+ * Return Value:        int - represents the line to replace
+ * Purpose:             Returns the line of the set with the lowest time clock
+ ***************************************************************************************/
+inline int LRUPolicy::GetVictim(int firstLine) {
+    // Lower time clock means least recently used item (Wide sets use vector compares)
+    return firstLine + FindLowestWay(&timeClock[firstLine], mappingAssociation);
+}
+
+/****************************************************************************************
+ * Class Name:          FIFOPolicy
+ * Purpose:             Evicts the line of a set that was filled first
+ ***************************************************************************************/
+class FIFOPolicy {
+    public:
+        // Policy Functions
+        void SetPolicy(int cacheLines, int mappingAssociation);
+        void Hit(int line, int nextUse);
+        void Fill(int line, int nextUse);
+        int GetVictim(int firstLine);
+
+    private:
+        // Variables Set by User
+        int mappingAssociation;
+
+        // Time Variables (Virtual clock counts fills, timeClock is each line's fill)
+        long long virtualClock;
+        vector<long long> timeClock;
+};
+
+/****************************************************************************************
+ * Function Name:       Hit
+ * Input Parameters:    int line - not used
+ *                      int nextUse - not used
+ * Return Value:        void
+ * Purpose:             Nothing to do: hits do not change the order lines were filled
+ ***************************************************************************************/
+inline void FIFOPolicy::Hit(int line, int nextUse) {
+}
+
+/****************************************************************************************
+ * Function Name:       Fill
+ * Input Parameters:    int line - represents the cache line filled
+ *                      int nextUse - not used
+ * Return Value:        void
+ * Purpose:             Makes the new line the last in its set's queue
+ ***************************************************************************************/
+inline void FIFOPolicy::Fill(int line, int nextUse) {
+    // Set time clock at line to the incremented virtual clock
+    virtualClock++;
+    timeClock[line] = virtualClock;
+}
+
+/****************************************************************************************
+ * Function Name:       GetVictim
+ * Input Parameters:    int - represents the first line of a full set
+ * Return Value:        int - represents the line to replace
+ * Purpose:             Returns the line of the set with the lowest time clock
+ ***************************************************************************************/
+inline int FIFOPolicy::GetVictim(int firstLine) {
+    // Lower time clock means first item entered (Wide sets use vector compares)
+    return firstLine + FindLowestWay(&timeClock[firstLine], mappingAssociation);
+}
+
+/****************************************************************************************
+ * Class Name:          TreePLRUPolicy
+ * Purpose:             Evicts the line a per-set binary tree of bits points to
+ ***************************************************************************************/
+class TreePLRUPolicy {
+    public:
+        // Policy Functions
+        void SetPolicy(int cacheLines, int mappingAssociation);
+        void Hit(int line, int nextUse);
+        void Fill(int line, int nextUse);
+        int GetVictim(int firstLine);
+
+    private:
+        // Variables Set by User
+        int mappingAssociation;
+
+        // Tree bits, N per set: node n (1 to N - 1) has children 2n and 2n + 1, and
+        // leaf N + j is way j. A bit of 0 points left, 1 points right.
+        vector<unsigned char> treeBits;
+
+        // Helper Functions
+        void Touch(int line);
+};
+
+/****************************************************************************************
+ * Function Name:       Hit
+ * Input Parameters:    int line - represents the cache line accessed
+ *                      int nextUse - not used
+ * Return Value:        void
+ * Purpose:             Points the tree away from the line
+ ***************************************************************************************/
+inline void TreePLRUPolicy::Hit(int line, int nextUse) {
+    // Protect the line
+    Touch(line);
+}
+
+/****************************************************************************************
+ * Function Name:       Fill
+ * Input Parameters:    int line - represents the cache line filled
+ *                      int nextUse - not used
+ * Return Value:        void
+ * Purpose:             Points the tree away from the new line
+ ***************************************************************************************/
+inline void TreePLRUPolicy::Fill(int line, int nextUse) {
+    // Protect the line
+    Touch(line);
+}
+
+/****************************************************************************************
+ * Function Name:       GetVictim
+ * Input Parameters:    int - represents the first line of a full set
+ * Return Value:        int - represents the line to replace
+ * Purpose:             Follows the set's tree bits from the root to a leaf
+ ***************************************************************************************/
+inline int TreePLRUPolicy::GetVictim(int firstLine) {
+    // Walk down from the root (node 1)
+    int node = 1;
+    while(node < mappingAssociation) {
+        node = (2 * node) + treeBits[firstLine + node];
+    }
+
+    // Leaf N + j is way j
+    return firstLine + (node - mappingAssociation);
+}
+
+/****************************************************************************************
+ * Function Name:       Touch
+ * Input Parameters:    int - represents the cache line accessed or filled
+ * Return Value:        void
+ * Purpose:             Sets each bit on the path from the line's leaf to the root to
+ *                      point at the other child
+ ***************************************************************************************/
+inline void TreePLRUPolicy::Touch(int line) {
+    // First line of the set and the line's leaf
+    int way = line % mappingAssociation;
+    int firstLine = line - way;
+    int node = mappingAssociation + way;
+
+    // Walk up to the root, pointing each parent at the sibling
+    while(node > 1) {
+        treeBits[firstLine + (node / 2)] = ((node % 2) == 0) ? 1 : 0;
+        node = node / 2;
+    }
+}
+
+/****************************************************************************************
+ * Class Name:          RRIPPolicy
+ * Purpose:             Evicts a line predicted to be re-referenced in the distant
+ *                      future. bimodal = false is SRRIP, bimodal = true is BRRIP.
+ ***************************************************************************************/
+template <bool bimodal>
+class RRIPPolicy {
+    public:
+        // Policy Functions
+        void SetPolicy(int cacheLines, int mappingAssociation);
+        void Hit(int line, int nextUse);
+        void Fill(int line, int nextUse);
+        int GetVictim(int firstLine);
+
+    private:
+        // Variables Set by User
+        int mappingAssociation;
+
+        // Re-reference prediction value of each line
+        vector<unsigned char> rrpv;
+
+        // Random number generator of each set (Only used by BRRIP)
+        vector<unsigned int> randomState;
+};
+
+// SRRIP and BRRIP
+typedef RRIPPolicy<false> SRRIPPolicy;
+typedef RRIPPolicy<true> BRRIPPolicy;
+
+/****************************************************************************************
+ * Function Name:       SetPolicy
+ * Input Parameters:    int cacheLines - represents the number of lines in the table
+ *                      int mappingAssociation - represents the N of N-way mapping
+ * Return Value:        void
+ * Purpose:             Predicts every line distant and seeds every set's generator
+ ***************************************************************************************/
+template <bool bimodal>
+void RRIPPolicy<bimodal>::SetPolicy(int cacheLines, int mappingAssociation) {
+    // Store User Settings
+    this->mappingAssociation = mappingAssociation;
+
+    // Every line distant, every generator at the seed
+    rrpv.assign(cacheLines, RRPV_MAX);
+    randomState.assign(cacheLines / mappingAssociation, RANDOM_SEED);
+}
+
+/****************************************************************************************
+ * Function Name:       Hit
+ * Input Parameters:    int line - represents the cache line accessed
+ *                      int nextUse - not used
+ * Return Value:        void
+ * Purpose:             Predicts the line will be re-referenced soon
+ ***************************************************************************************/
+template <bool bimodal>
+void RRIPPolicy<bimodal>::Hit(int line, int nextUse) {
+    // Near-immediate re-reference
+    rrpv[line] = 0;
+}
+
+/****************************************************************************************
+ * Function Name:       Fill
+ * Input Parameters:    int line - represents the cache line filled
+ *                      int nextUse - not used
+ * Return Value:        void
+ * Purpose:             Predicts a long re-reference interval for a new line (SRRIP),
+ *                      or a distant one for all but 1 in 32 new lines (BRRIP)
+ ***************************************************************************************/
+template <bool bimodal>
+void RRIPPolicy<bimodal>::Fill(int line, int nextUse) {
+    // SRRIP: long re-reference interval
+    rrpv[line] = RRPV_MAX - 1;
+
+    // BRRIP: distant unless the set's generator picks 1 in 32
+    if(bimodal && ((NextRandom(randomState[line / mappingAssociation]) & 31) != 0)) {
+        rrpv[line] = RRPV_MAX;
+    }
+}
+
+/****************************************************************************************
+ * Function Name:       GetVictim
+ * Input Parameters:    int - represents the first line of a full set
+ * Return Value:        int - represents the line to replace
+ * Purpose:             Returns the first line predicted distant. If no line is, the
+ *                      whole set is aged until the oldest prediction becomes distant.
+ ***************************************************************************************/
+template <bool bimodal>
+int RRIPPolicy<bimodal>::GetVictim(int firstLine) {
+    // Find the first distant line and the largest prediction
+    int victim = firstLine;
+    for(int j=0; j < mappingAssociation; j++) {
+        if(rrpv[firstLine + j] == RRPV_MAX) {
+            return firstLine + j;
+        }
+        if(rrpv[firstLine + j] > rrpv[victim]) {
+            victim = firstLine + j;
+        }
+    }
+
+    // Age the set as many steps as it takes the largest prediction to become distant
+    unsigned char age = RRPV_MAX - rrpv[victim];
+    for(int j=0; j < mappingAssociation; j++) {
+        rrpv[firstLine + j] += age;
+    }
+
+    return victim;
+}
+
+/****************************************************************************************
+ * Class Name:          RandomPolicy
+ * Purpose:             Evicts a random line of the set
+ ***************************************************************************************/
+class RandomPolicy {
+    public:
+        // Policy Functions
+        void SetPolicy(int cacheLines, int mappingAssociation);
+        void Hit(int line, int nextUse);
+        void Fill(int line, int nextUse);
+        int GetVictim(int firstLine);
+
+    private:
+        // Variables Set by User
+        int mappingAssociation;
+
+        // Random number generator of each set
+        vector<unsigned int> randomState;
+};
+
+/****************************************************************************************
+ * Function Name:       Hit
+ * Input Parameters:    int line - not used
+ *                      int nextUse - not used
+ * Return Value:        void
+ * Purpose:             Nothing to do: random replacement keeps no history
+ ***************************************************************************************/
+inline void RandomPolicy::Hit(int line, int nextUse) {
+}
+
+/****************************************************************************************
+ * Function Name:       Fill
+ * Input Parameters:    int line - not used
+ *                      int nextUse - not used
+ * Return Value:        void
+ * Purpose:             Nothing to do: random replacement keeps no history
+ ***************************************************************************************/
+inline void RandomPolicy::Fill(int line, int nextUse) {
+}
+
+/****************************************************************************************
+ * Function Name:       GetVictim
+ * Input Parameters:    int - represents the first line of a full set
+ * Return Value:        int - represents the line to replace
+ * Purpose:             Returns a line of the set picked by the set's generator
+ ***************************************************************************************/
+inline int RandomPolicy::GetVictim(int firstLine) {
+    // Random way of the set
+    unsigned int random = NextRandom(randomState[firstLine / mappingAssociation]);
+    return firstLine + (int)(random % (unsigned int)mappingAssociation);
+}
+
+/****************************************************************************************
+ * Class Name:          LFUPolicy
+ * Purpose:             Evicts the least frequently used line of a set
+ ***************************************************************************************/
+class LFUPolicy {
+    public:
+        // Policy Functions
+        void SetPolicy(int cacheLines, int mappingAssociation);
+        void Hit(int line, int nextUse);
+        void Fill(int line, int nextUse);
+        int GetVictim(int firstLine);
+
+    private:
+        // Variables Set by User
+        int mappingAssociation;
+
+        // Number of accesses to each line since it was filled
+        vector<long long> useCount;
+};
+
+/****************************************************************************************
+ * Function Name:       Hit
+ * Input Parameters:    int line - represents the cache line accessed
+ *                      int nextUse - not used
+ * Return Value:        void
+ * Purpose:             Counts another use of the line
+ ***************************************************************************************/
+inline void LFUPolicy::Hit(int line, int nextUse) {
+    // Increment use count
+    useCount[line]++;
+}
+
+/****************************************************************************************
+ * Function Name:       Fill
+ * Input Parameters:    int line - represents the cache line filled
+ *                      int nextUse - not used
+ * Return Value:        void
+ * Purpose:             Starts the new line's use count at 1
+ ***************************************************************************************/
+inline void LFUPolicy::Fill(int line, int nextUse) {
+    // First use
+    useCount[line] = 1;
+}
+
+/****************************************************************************************
+ * Function Name:       GetVictim
+ * Input Parameters:    int - represents the first line of a full set
+ * Return Value:        int - represents the line to replace
+ * Purpose:             Returns the line of the set with the lowest use count
+ ***************************************************************************************/
+inline int LFUPolicy::GetVictim(int firstLine) {
+    // Lower use count means less frequently used item (Wide sets use vector compares)
+    return firstLine + FindLowestWay(&useCount[firstLine], mappingAssociation);
+}
+
+/****************************************************************************************
+ * Class Name:          ListPolicy
+ * Purpose:             Evicts the line at the head of a doubly linked list of every
+ *                      line. Lines move to the tail when filled, and also when hit if
+ *                      moveOnHit is set. moveOnHit = true is LRU, false is FIFO.
+ *                      Only used for a cache of one set (fully associative), since
+ *                      the list holds every line of the table.
+ ***************************************************************************************/
+template <bool moveOnHit>
+class ListPolicy {
+    public:
+        // Policy Functions
+        void SetPolicy(int cacheLines, int mappingAssociation);
+        void Hit(int line, int nextUse);
+        void Fill(int line, int nextUse);
+        int GetVictim(int firstLine);
+
+    private:
+        // List of Lines, head first (-1 ends the list in either direction)
+        vector<int> previous;
+        vector<int> next;
+        int head;
+        int tail;
+
+        // Helper Functions
+        void MoveToTail(int line);
+};
+
+// LRU and FIFO of a fully associative cache
+typedef ListPolicy<true> LRUListPolicy;
+typedef ListPolicy<false> FIFOListPolicy;
+
+/****************************************************************************************
+ * Function Name:       SetPolicy
+ * Input Parameters:    int cacheLines - represents the number of lines in the table
+ *                      int mappingAssociation - not used (the set is every line)
+ * Return Value:        void
+ * Purpose:             Links every line into the list in line order
+ ***************************************************************************************/
+template <bool moveOnHit>
+void ListPolicy<moveOnHit>::SetPolicy(int cacheLines, int mappingAssociation) {
+    // Line i sits between lines i - 1 and i + 1
+    previous.resize(cacheLines);
+    next.resize(cacheLines);
+    for(int i=0; i < cacheLines; i++) {
+        previous[i] = i - 1;
+        next[i] = i + 1;
+    }
+    if(cacheLines > 0) {
+        next[cacheLines - 1] = -1;
+    }
+    head = 0;
+    tail = cacheLines - 1;
+}
+
+/****************************************************************************************
+ * Function Name:       Hit
+ * Input Parameters:    int line - represents the cache line accessed
+ *                      int nextUse - not used
+ * Return Value:        void
+ * Purpose:             Makes the line the most recently used (LRU only)
+ ***************************************************************************************/
+template <bool moveOnHit>
+inline void ListPolicy<moveOnHit>::Hit(int line, int nextUse) {
+    // FIFO order does not change on hits
+    if(moveOnHit) {
+        MoveToTail(line);
+    }
+}
+
+/****************************************************************************************
+ * Function Name:       Fill
+ * Input Parameters:    int line - represents the cache line filled
+ *                      int nextUse - not used
+ * Return Value:        void
+ * Purpose:             Makes the new line the last to be replaced
+ ***************************************************************************************/
+template <bool moveOnHit>
+inline void ListPolicy<moveOnHit>::Fill(int line, int nextUse) {
+    // Newest line goes to the tail
+    MoveToTail(line);
+}
+
+/****************************************************************************************
+ * Function Name:       GetVictim
+ * Input Parameters:    int - represents the first line of the full cache (not used)
+ * Return Value:        int - represents the line to replace
+ * Purpose:             Returns the head of the list, the line used (LRU) or filled
+ *                      (FIFO) longest ago. The same line the time clock policies pick.
+ ***************************************************************************************/
+template <bool moveOnHit>
+inline int ListPolicy<moveOnHit>::GetVictim(int firstLine) {
+    // Oldest line
+    return head;
+}
+
+/****************************************************************************************
+ * Function Name:       MoveToTail
+ * Input Parameters:    int - represents the cache line to move
+ * Return Value:        void
+ * Purpose:             Unlinks the line from its place in the list and links it back
+ *                      in at the tail
+ ***************************************************************************************/
+template <bool moveOnHit>
+inline void ListPolicy<moveOnHit>::MoveToTail(int line) {
+    // Already the tail
+    if(line == tail) {
+        return;
+    }
+
+    // Unlink (The line is not the tail, so it has a next line)
+    if(previous[line] >= 0) {
+        next[previous[line]] = next[line];
+    }
+    else {
+        head = next[line];
+    }
+    previous[next[line]] = previous[line];
+
+    // Link in after the old tail
+    previous[line] = tail;
+    next[line] = -1;
+    next[tail] = line;
+    tail = line;
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,520 @@
+/****************************************************************************************
+ *  Memory Simulator: "ResultWriter.cpp"
+ *
+ *  Author:     Hannah Perkins
+ *  CWID:       11472559
+ *  Assignment: Lab #7
+ *
+ *  Date:       17 October 2026
+ *  Course:     ECE 487
+ *
+ *  Function:   Writes the per-access results of a simulation
+ *
+ *  Description: Result Writer Class that writes the rows of the Address Table (one
+ *          row per memory access) to the console or a file. Rows are formatted into
+ *          a large buffer that is written out in one piece when full, instead of
+ *          flushing every line. The writer is set up with an output spec:
+ *
+ *              <format>[,<key>=<value>...]
+ *
+ *          Formats:
+ *
+ *              table       the Address Table as printed by the lab, followed by the
+ *                          cache table
+ *              csv         one CSV row per access (no cache table)
+ *              binary      the binary result format below (no cache table)
+ *              summary     no rows, only the cache table
+ *
+ *          Keys:
+ *
+ *              every       write every N-th row only        (default 1)
+ *              from        write rows with address >= from  (default 0)
+ *              to          write rows with address <= to    (default no limit)
+ *              file        write to this file instead of the console
+ *              sets        after the hit rates, list the N hottest and N most
+ *                          conflicted cache sets (default 0, no list; see
+ *                          "HotspotReport.cpp")
+ *              window      while the trace runs, print hit rate, miss rate,
+ *                          writebacks, and unique blocks every N accesses and
+ *                          list the program phases found (default 0, no
+ *                          windows; see "IntervalStats.cpp")
+ *
+ *          Example: csv,every=1000,file=results.csv
+ *
+ *          Hit rates and the other summary lines are always printed on the console.
+ *
+ *          Binary Result Format:
+ *
+ *              Header (17 bytes):
+ *                  4 bytes     magic "CMSR"
+ *                  1 byte      format version (2)
+ *                  4 bytes     block size, little-endian
+ *                  4 bytes     number of cache sets, little-endian
+ *                  4 bytes     set-associativity, little-endian
+ *
+ *              Each Row (2 to 20 bytes):
+ *                  varint      ((row number - previous row number written) << 2) |
+ *                              (isWrite << 1) | hit, 1 to 10 bytes
+ *                  varint      zigzag(address - previous address), all 64 bits,
+ *                              1 to 10 bytes
+ *
+ *          The varints are the same as the binary trace format ("BinaryTrace.cpp"),
+ *          so the main memory block and cache set of a row can be recomputed from its
+ *          address and the header.
+ *
+ ***************************************************************************************/
+
+#ifndef RESULTWRITER_CPP
+#define RESULTWRITER_CPP
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <string.h>
+#include <stdlib.h>
+#include <limits.h>
+#include "Address.h"
+using namespace std;
+
+// Result Formats
+const int TABLE_FORMAT = 0;
+const int CSV_FORMAT = 1;
+const int BINARY_FORMAT = 2;
+const int SUMMARY_FORMAT = 3;
+
+// Binary Result Format Constants
+const char BINARY_RESULT_MAGIC[4] = {'C', 'M', 'S', 'R'};
+const unsigned char BINARY_RESULT_VERSION = 2;
+
+// Bytes formatted before the buffer is written out
+const int RESULT_BUFFER_SIZE = 1 << 20;
+
+/****************************************************************************************
+ * Class Name:          ResultWriter
+ * Purpose:             Formats Address Table rows into a buffer and writes them to the
+ *                      console or a file in the chosen format
+ ***************************************************************************************/
+class ResultWriter {
+    public:
+        ResultWriter();                             // Constructor
+        ~ResultWriter();                            // Destructor
+
+        // User Functions
+        bool SetWriter(string spec);
+        bool Open();
+        void WriteHeader(int blockSize, int cacheSets, int mappingAssociation);
+        void WriteRow(long long row, Address address, bool isWrite, Address block, int set,
+                int firstCMBlock, int mappingAssociation, bool hit);
+        void Flush();
+        void Close();
+
+        // Getter Functions
+        ostream& GetStream();
+        bool GetWritesRows();
+        bool GetWritesCacheTable();
+        int GetHotspotSets();
+        long long GetWindowSize();
+
+    private:
+        // Variables Set by User
+        int format;
+        long long every;
+        Address fromAddress;
+        Address toAddress;
+        string fileName;
+        int hotspotSets;
+        long long windowSize;
+
+        // Output (Console or File) and its Buffer
+        ofstream file;
+        ostream* output;
+        string buffer;
+
+        // Previous row written (Binary rows are delta-encoded)
+        long long previousRow;
+        Address previousAddress;
+
+        // Helper Functions
+        void AppendNumber(unsigned long long number);
+        void AppendVarint(unsigned long long value);
+        void AppendLittleEndian(int value);
+};
+
+/****************************************************************************************
+ * Constructor
+ ***************************************************************************************/
+ResultWriter::ResultWriter() {
+    // Table of every row on the console until SetWriter is called
+    SetWriter("table");
+    output = &cout;
+    previousRow = 0;
+    previousAddress = 0;
+    buffer.reserve(RESULT_BUFFER_SIZE + 256);
+}
+
+/****************************************************************************************
+ * Destructor
+ ***************************************************************************************/
+ResultWriter::~ResultWriter() {
+    // Write what is left and close the file
+    Close();
+}
+
+/****************************************************************************************
+ * Function Name:       SetWriter
+ * Input Parameters:    string - represents the output spec ("<format>,<key>=<value>...")
+ * Return Value:        bool - represents whether the spec was understood (1) or not (0)
+ * Purpose:             Sets the format, the row filters, and the output file. Keys not
+ *                      in the spec keep their defaults.
+ ***************************************************************************************/
+bool ResultWriter::SetWriter(string spec) {
+    // Temporary Variable for each Field
+    string field;
+
+    // Defaults
+    format = TABLE_FORMAT;
+    every = 1;
+    fromAddress = 0;
+    toAddress = (Address)-1;                // No limit
+    fileName = "";
+    hotspotSets = 0;
+    windowSize = 0;
+
+    // Split fields at commas (The first field is the format)
+    istringstream fields (spec);
+    if(!getline(fields, field, ',')) {
+        return false;
+    }
+
+    // Match Format
+    if(field == "table")            format = TABLE_FORMAT;
+    else if(field == "csv")         format = CSV_FORMAT;
+    else if(field == "binary")      format = BINARY_FORMAT;
+    else if(field == "summary")     format = SUMMARY_FORMAT;
+    else                            return false;
+
+    // Read "key=value" Fields
+    while(getline(fields, field, ',')) {
+        // Split Key and Value
+        size_t equals = field.find('=');
+        if((equals == string::npos) || (equals + 1 == field.length())) {
+            return false;
+        }
+        string key = field.substr(0, equals);
+        string value = field.substr(equals + 1);
+
+        // File name is text, every other key is a number
+        if(key == "file") {
+            fileName = value;
+            continue;
+        }
+        char* end;
+        unsigned long long number = strtoull(value.c_str(), &end, 0);
+        if((*end != '\0') || (value[0] == '-')) {
+            return false;
+        }
+
+        // Apply Key (Addresses use all 64 bits, counts are kept below LLONG_MAX)
+        long long count = (long long)min(number, (unsigned long long)LLONG_MAX);
+        if(key == "every")          every = max(count, 1LL);
+        else if(key == "from")      fromAddress = number;
+        else if(key == "to")        toAddress = number;
+        else if(key == "sets")      hotspotSets = (int)min(count, 1000000LL);
+        else if(key == "window")    windowSize = count;
+        else                        return false;
+    }
+
+    return true;
+}
+
+/****************************************************************************************
+ * Function Name:       Open
+ * Input Parameters:    void
+ * Return Value:        bool - represents whether the output file was opened (1) or
+ *                      not (0). Always 1 for the console.
+ * Purpose:             Opens the output file chosen by the spec, or uses the console
+ ***************************************************************************************/
+bool ResultWriter::Open() {
+    // Finish any previous output
+    Close();
+
+    // Console
+    if(fileName.length() == 0) {
+        output = &cout;
+        return true;
+    }
+
+    // File (Binary so nothing is translated)
+    file.open(fileName, ios::out | ios::binary | ios::trunc);
+    if(!file.is_open()) {
+        output = &cout;
+        return false;
+    }
+    output = &file;
+    return true;
+}
+
+/****************************************************************************************
+ * Function Name:       WriteHeader
+ * Input Parameters:    int blockSize - represents the block size in bytes
+ *                      int cacheSets - represents the number of cache sets
+ *                      int mappingAssociation - represents the set-associativity
+ * Return Value:        void
+ * Purpose:             Writes the table column headers, the CSV column names, or the
+ *                      binary header, before the first row
+ ***************************************************************************************/
+void ResultWriter::WriteHeader(int blockSize, int cacheSets, int mappingAssociation) {
+    // Rows are numbered from the start of the output
+    previousRow = 0;
+    previousAddress = 0;
+
+    // Table Column Headers
+    if(format == TABLE_FORMAT) {
+        buffer += "\nmain memory address\tmm blk #\tcm set #\tcm blk #\thit/miss\n";
+        buffer += "----------------------------------------------------------------------";
+        buffer += "--------------\n";
+    }
+    // CSV Column Names
+    else if(format == CSV_FORMAT) {
+        buffer += "row,address,operation,mm_block,cm_set,first_cm_block,last_cm_block,hit\n";
+    }
+    // Binary Header
+    else if(format == BINARY_FORMAT) {
+        buffer.append(BINARY_RESULT_MAGIC, 4);
+        buffer += (char)BINARY_RESULT_VERSION;
+        AppendLittleEndian(blockSize);
+        AppendLittleEndian(cacheSets);
+        AppendLittleEndian(mappingAssociation);
+    }
+}
+
+/****************************************************************************************
+ * Function Name:       WriteRow
+ * Input Parameters:    long long row - represents the row number (0 = first access)
+ *                      Address address - represents the main memory address
+ *                      bool isWrite - represents whether the access was a write
+ *                      Address block - represents the main memory block number
+ *                      int set - represents the cache memory set number
+ *                      int firstCMBlock - represents the first cache memory block
+ *                      of the set
+ *                      int mappingAssociation - represents the number of cache
+ *                      memory blocks in the set
+ *                      bool hit - represents whether the access was a hit
+ * Return Value:        void
+ * Purpose:             Formats one row of the Address Table into the buffer if it
+ *                      passes the every/from/to filters. The buffer is written out
+ *                      when full.
+ ***************************************************************************************/
+void ResultWriter::WriteRow(long long row, Address address, bool isWrite, Address block, int set,
+        int firstCMBlock, int mappingAssociation, bool hit) {
+    // Skip rows filtered out (and every row of a summary)
+    if((format == SUMMARY_FORMAT) || ((row % every) != 0) || (address < fromAddress) ||
+            (address > toAddress)) {
+        return;
+    }
+
+    // Table Row: same columns and tabs as the lab's Address Table
+    if(format == TABLE_FORMAT) {
+        // Main Memory Address, Block Number, and Cache Set Number
+        buffer += '\t';
+        AppendNumber(address);
+        buffer += "\t\t";
+        AppendNumber(block);
+        buffer += "\t\t";
+        AppendNumber(set);
+        buffer += "\t\t";
+
+        // Cache Block Number ("#", "# or #", or "# to #")
+        AppendNumber(firstCMBlock);
+        if(mappingAssociation == 2) {
+            buffer += " or ";
+            AppendNumber(firstCMBlock + 1);
+        }
+        else if(mappingAssociation > 2) {
+            buffer += " to ";
+            AppendNumber(firstCMBlock + mappingAssociation - 1);
+        }
+
+        // Indentation/Formatting tabs, then Hit or Miss
+        buffer += ((firstCMBlock < 10) || (mappingAssociation == 1)) ? "\t\t" : "\t";
+        buffer += hit ? "hit\n" : "miss\n";
+    }
+    // CSV Row
+    else if(format == CSV_FORMAT) {
+        AppendNumber(row);
+        buffer += ',';
+        AppendNumber(address);
+        buffer += isWrite ? ",W," : ",R,";
+        AppendNumber(block);
+        buffer += ',';
+        AppendNumber(set);
+        buffer += ',';
+        AppendNumber(firstCMBlock);
+        buffer += ',';
+        AppendNumber(firstCMBlock + mappingAssociation - 1);
+        buffer += hit ? ",1\n" : ",0\n";
+    }
+    // Binary Row: row delta with the write and hit bits, then zigzag address delta
+    // (The address delta keeps all 64 bits, so any jump in a 2^64 memory decodes)
+    else {
+        long long delta = (long long)(address - previousAddress);
+        unsigned long long zigzag = ((unsigned long long)delta << 1) ^ (unsigned long long)(delta >> 63);
+        AppendVarint(((unsigned long long)(row - previousRow) << 2) |
+                ((unsigned long long)isWrite << 1) | (unsigned long long)hit);
+        AppendVarint(zigzag);
+        previousRow = row;
+        previousAddress = address;
+    }
+
+    // Write out a full buffer
+    if((int)buffer.size() >= RESULT_BUFFER_SIZE) {
+        Flush();
+    }
+}
+
+/****************************************************************************************
+ * Function Name:       Flush
+ * Input Parameters:    void
+ * Return Value:        void
+ * Purpose:             Writes the buffered rows to the output in one piece. Called
+ *                      before anything else is printed to the same output.
+ ***************************************************************************************/
+void ResultWriter::Flush() {
+    // Write and empty the buffer (It keeps its memory)
+    if(buffer.size() > 0) {
+        output->write(buffer.data(), buffer.size());
+        buffer.clear();
+    }
+    output->flush();
+}
+
+/****************************************************************************************
+ * Function Name:       Close
+ * Input Parameters:    void
+ * Return Value:        void
+ * Purpose:             Writes what is left in the buffer and closes the output file
+ ***************************************************************************************/
+void ResultWriter::Close() {
+    // Write what is left
+    Flush();
+
+    // Close File and go back to the console
+    if(file.is_open()) {
+        file.close();
+    }
+    output = &cout;
+}
+
+/****************************************************************************************
+ * Function Name:       GetStream
+ * Input Parameters:    void
+ * Return Value:        ostream& - represents the console or the output file
+ * Purpose:             Returns the output so other tables (the cache table) can be
+ *                      printed to it. Buffered rows are written first.
+ ***************************************************************************************/
+ostream& ResultWriter::GetStream() {
+    // Keep the output in order
+    Flush();
+    return *output;
+}
+
+/****************************************************************************************
+ * Function Name:       GetWritesRows
+ * Input Parameters:    void
+ * Return Value:        bool - represents whether any Address Table rows are written
+ * Purpose:             Returns false for a summary, so callers can skip row work
+ ***************************************************************************************/
+bool ResultWriter::GetWritesRows() {
+    // Every format but summary writes rows
+    return format != SUMMARY_FORMAT;
+}
+
+/****************************************************************************************
+ * Function Name:       GetWritesCacheTable
+ * Input Parameters:    void
+ * Return Value:        bool - represents whether the cache table is printed
+ * Purpose:             Returns true for the table and summary formats
+ ***************************************************************************************/
+bool ResultWriter::GetWritesCacheTable() {
+    // CSV and binary outputs hold only rows
+    return (format == TABLE_FORMAT) || (format == SUMMARY_FORMAT);
+}
+
+/****************************************************************************************
+ * Function Name:       GetHotspotSets
+ * Input Parameters:    void
+ * Return Value:        int - represents how many hottest and most conflicted sets to
+ *                      list (0 = no hotspot report)
+ * Purpose:             Returns the "sets" key of the output spec
+ ***************************************************************************************/
+int ResultWriter::GetHotspotSets() {
+    // Return the Number of Sets to List
+    return hotspotSets;
+}
+
+/****************************************************************************************
+ * Function Name:       GetWindowSize
+ * Input Parameters:    void
+ * Return Value:        long long - represents the accesses per interval window (0 = no
+ *                      interval statistics)
+ * Purpose:             Returns the "window" key of the output spec
+ ***************************************************************************************/
+long long ResultWriter::GetWindowSize() {
+    // Return the Accesses per Window
+    return windowSize;
+}
+
+/****************************************************************************************
+ * Function Name:       AppendNumber
+ * Input Parameters:    unsigned long long - represents the number to format (rows,
+ *                      64-bit addresses, blocks, and sets are never negative)
+ * Return Value:        void
+ * Purpose:             Appends the decimal digits of a number to the buffer without
+ *                      creating a string
+ ***************************************************************************************/
+void ResultWriter::AppendNumber(unsigned long long number) {
+    // Digits are made backwards into a small array
+    char digits[24];
+    int count = 0;
+    do {
+        digits[count++] = (char)('0' + (number % 10));
+        number /= 10;
+    } while(number > 0);
+
+    // Append them in order
+    while(count > 0) {
+        buffer += digits[--count];
+    }
+}
+
+/****************************************************************************************
+ * Function Name:       AppendVarint
+ * Input Parameters:    unsigned long long - represents the value to encode
+ * Return Value:        void
+ * Purpose:             Appends 7 bits of the value per byte, lowest first, with the
+ *                      high bit set on every byte except the last
+ ***************************************************************************************/
+void ResultWriter::AppendVarint(unsigned long long value) {
+    // Seven bits at a time
+    while(value >= 0x80) {
+        buffer += (char)((value & 0x7F) | 0x80);
+        value >>= 7;
+    }
+    buffer += (char)value;
+}
+
+/****************************************************************************************
+ * Function Name:       AppendLittleEndian
+ * Input Parameters:    int - represents the value to write
+ * Return Value:        void
+ * Purpose:             Appends the 4 bytes of a value, lowest byte first
+ ***************************************************************************************/
+void ResultWriter::AppendLittleEndian(int value) {
+    // Lowest byte first
+    for(int i=0; i < 4; i++) {
+        buffer += (char)(((unsigned int)value >> (8 * i)) & 0xFF);
+    }
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,383 @@
+/****************************************************************************************
+ *  Memory Simulator: "StackDistance.cpp"
+ *
+ *  Author:     Hannah Perkins
+ *  CWID:       11472559
+ *  Assignment: Lab #7
+ *
+ *  Date:       17 October 2026
+ *  Course:     ECE 487
+ *
+ *  Function:   Calculates LRU hit rates for every cache size in one pass
+ *
+ *  Description: Stack Distance Class that implements Mattson's stack algorithm. For
+ *          an LRU cache, an access hits in an N-way set if fewer than N other blocks
+ *          of the same set were used since the block was last used. That count is
+ *          the access's stack (reuse) distance, and it does not depend on N. So one
+ *          histogram of stack distances gives the hit rate of every associativity
+ *          at once.
+ *
+ *          The set a block maps to does depend on the number of sets, so one
+ *          histogram is kept per "family" of caches with the same number of sets
+ *          (1, 2, 4, ... sets). Every family sees every access.
+ *
+ *          Inside a family, each set numbers its accesses 1, 2, 3, ... and keeps a
+ *          Fenwick (binary indexed) tree with a 1 at the latest access number of
+ *          each block. The stack distance of an access is the number of 1's after
+ *          the block's previous access number, which the Fenwick tree counts in
+ *          O(log n). When a set's tree grows to twice the number of blocks in the
+ *          set, it is compacted, so memory grows with the number of unique blocks
+ *          rather than with the length of the trace.
+ *
+ ***************************************************************************************/
+
+#ifndef STACKDISTANCE_CPP
+#define STACKDISTANCE_CPP
+
+#include "Address.h"
+#include <iostream>
+#include <vector>
+#include <unordered_map>
+using namespace std;
+
+/****************************************************************************************
+ * Struct Name:         StackSet
+ * Purpose:             Holds the Fenwick tree and the block at each access number of
+ *                      one cache set of one family
+ ***************************************************************************************/
+struct StackSet {
+    // Fenwick tree over access numbers (1-indexed, tree[0] unused)
+    vector<int> tree;
+
+    // Block id at each access number (-1 once the block was used again)
+    vector<int> owner;
+
+    // Number of different blocks in the set
+    int liveBlocks;
+};
+
+/****************************************************************************************
+ * Struct Name:         StackFamily
+ * Purpose:             Holds the sets and the stack distance histogram of all caches
+ *                      with the same number of sets
+ ***************************************************************************************/
+struct StackFamily {
+    int cacheSets;
+    int maxWays;
+    vector<StackSet> sets;
+
+    // histogram[d] = accesses with stack distance d (d = maxWays holds all larger)
+    vector<long long> histogram;
+};
+
+/****************************************************************************************
+ * Class Name:          StackDistance
+ * Purpose:             Builds stack distance histograms for every power-of-two number
+ *                      of sets in one pass and prints the LRU miss ratio curve
+ ***************************************************************************************/
+class StackDistance {
+    public:
+        StackDistance();                            // Constructor
+
+        // User Functions
+        void SetStackDistance(int blockSize, int maxCacheSize);
+        void Access(Address address);
+        void Print();
+
+        // Getter Functions
+        long long GetHits(int cacheSets, int mappingAssociation);
+        long long GetTotalAccesses();
+        long long GetColdMisses();
+
+    private:
+        // Variables Set by User
+        int blockSize;
+        int maxLines;
+
+        // One family per power-of-two number of sets
+        vector<StackFamily> families;
+
+        // Dense id of every block seen and its latest access number per family
+        unordered_map<Address, int> blockIds;
+        vector<int> lastAccess;
+
+        // Counters
+        long long totalAccesses;
+        long long coldMisses;
+
+        // Helper Functions
+        void AccessFamily(int family, int id, Address block);
+        void Compact(int family, StackSet &set);
+};
+
+/****************************************************************************************
+ * Constructor
+ ***************************************************************************************/
+StackDistance::StackDistance() {
+    // Nothing accessed yet
+    blockSize = 1;
+    maxLines = 0;
+    totalAccesses = 0;
+    coldMisses = 0;
+}
+
+/****************************************************************************************
+ * Function Name:       SetStackDistance
+ * Input Parameters:    int blockSize - represents the block size in bytes
+ *                      int maxCacheSize - represents the largest cache size in bytes
+ *                      to report
+ * Return Value:        void
+ * Purpose:             Creates one family for each power-of-two number of sets from 1
+ *                      (fully associative) up to one set per cache line of the largest
+ *                      cache (direct mapped).
+ ***************************************************************************************/
+void StackDistance::SetStackDistance(int blockSize, int maxCacheSize) {
+    // Store User Settings
+    this->blockSize = blockSize;
+    maxLines = maxCacheSize / blockSize;
+
+    // Reset previous results
+    families.clear();
+    blockIds.clear();
+    lastAccess.clear();
+    totalAccesses = 0;
+    coldMisses = 0;
+
+    // Create Families of 1, 2, 4, ... sets
+    for(int sets = 1; sets <= maxLines; sets = sets * 2) {
+        StackFamily family;
+        family.cacheSets = sets;
+        family.maxWays = maxLines / sets;
+        family.sets.resize(sets);
+        family.histogram.resize(family.maxWays + 1, 0);
+
+        // Every set starts empty
+        for(int i=0; i < sets; i++) {
+            family.sets[i].tree.push_back(0);
+            family.sets[i].liveBlocks = 0;
+        }
+
+        families.push_back(family);
+    }
+}
+
+/****************************************************************************************
+ * Function Name:       Access
+ * Input Parameters:    Address - represents the main memory address to access
+ * Return Value:        void
+ * Purpose:             Records one memory access in every family. Reads and writes
+ *                      are treated the same since both update LRU order.
+ ***************************************************************************************/
+void StackDistance::Access(Address address) {
+    // Main Memory Block Number = Main Memory Address / Block Size
+    Address block = address / blockSize;
+
+    // Look up the block's id, adding new blocks
+    unordered_map<Address, int>::iterator found = blockIds.find(block);
+    int id;
+    if(found == blockIds.end()) {
+        // New block: first access is a cold miss in every family
+        id = blockIds.size();
+        blockIds[block] = id;
+        lastAccess.resize(lastAccess.size() + families.size(), -1);
+        coldMisses++;
+    }
+    else {
+        id = found->second;
+    }
+
+    // Count the access
+    totalAccesses++;
+
+    // Record access in each family
+    for(int i=0; i < (int)families.size(); i++) {
+        AccessFamily(i, id, block);
+    }
+}
+
+/****************************************************************************************
+ * Function Name:       Print
+ * Input Parameters:    void
+ * Return Value:        void
+ * Purpose:             Prints the LRU miss ratio curve: one row for every cache size
+ *                      and power-of-two associativity up to the largest cache size
+ ***************************************************************************************/
+void StackDistance::Print() {
+    // Print Title
+    cout << endl << "LRU miss ratio curve (" << totalAccesses << " accesses, ";
+    cout << coldMisses << " unique blocks):" << endl;
+
+    // Print Column Headers
+    cout << "cache size" << "\t" << "sets" << "\t" << "n-way" << "\t" << "hits";
+    cout << "\t\t" << "misses" << "\t\t" << "miss ratio" << endl;
+    cout << "----------------------------------------------------------------------";
+    cout << "--------------" << endl;
+
+    // Print one row per cache size, smallest first
+    for(int lines = 1; lines <= maxLines; lines = lines * 2) {
+        for(int i=0; i < (int)families.size(); i++) {
+            // Number of ways for this cache size
+            int ways = lines / families[i].cacheSets;
+            if(ways < 1) {
+                continue;
+            }
+
+            // Calculate Hits and Misses
+            long long hits = GetHits(families[i].cacheSets, ways);
+            long long misses = totalAccesses - hits;
+            double missRatio = 100.0 * ((double)misses / (double)totalAccesses);
+
+            // Print Row
+            cout << (lines * blockSize) << "\t\t" << families[i].cacheSets << "\t";
+            cout << ways << "\t" << hits << "\t\t" << misses << "\t\t";
+            cout << missRatio << "%" << endl;
+        }
+    }
+}
+
+/****************************************************************************************
+ * Function Name:       GetHits
+ * Input Parameters:    int cacheSets - represents the number of sets (power of two)
+ *                      int mappingAssociation - represents the N of N-way mapping
+ * Return Value:        long long - represents the number of LRU hits
+ * Purpose:             Returns the number of hits an LRU cache with the given number
+ *                      of sets and ways would have had. An access hits if its stack
+ *                      distance is less than the number of ways.
+ ***************************************************************************************/
+long long StackDistance::GetHits(int cacheSets, int mappingAssociation) {
+    // Declare hits, starting at 0
+    long long hits = 0;
+
+    // Find family with this number of sets
+    for(int i=0; i < (int)families.size(); i++) {
+        if(families[i].cacheSets == cacheSets) {
+            // Sum accesses with a stack distance less than the number of ways
+            for(int d=0; (d < mappingAssociation) && (d < families[i].maxWays); d++) {
+                hits += families[i].histogram[d];
+            }
+        }
+    }
+
+    // Return hits
+    return hits;
+}
+
+/****************************************************************************************
+ * Function Name:       GetTotalAccesses
+ * Input Parameters:    void
+ * Return Value:        long long - represents the number of accesses recorded
+ * Purpose:             Returns the number of memory accesses recorded
+ ***************************************************************************************/
+long long StackDistance::GetTotalAccesses() {
+    // Return totalAccesses
+    return totalAccesses;
+}
+
+/****************************************************************************************
+ * Function Name:       GetColdMisses
+ * Input Parameters:    void
+ * Return Value:        long long - represents the number of unique blocks
+ * Purpose:             Returns the number of first-time (cold) accesses, which miss
+ *                      in every cache size
+ ***************************************************************************************/
+long long StackDistance::GetColdMisses() {
+    // Return coldMisses
+    return coldMisses;
+}
+
+/****************************************************************************************
+ * Function Name:       AccessFamily
+ * Input Parameters:    int family - represents the family to update
+ *                      int id - represents the dense id of the block
+ *                      Address block - represents the main memory block number
+ * Return Value:        void
+ * Purpose:             Finds the stack distance of the access in the block's set,
+ *                      adds it to the family's histogram, and marks the block as
+ *                      most recently used.
+ ***************************************************************************************/
+void StackDistance::AccessFamily(int family, int id, Address block) {
+    // Get family and the set the block maps to (Power-of-two sets, so a mask)
+    StackFamily &current = families[family];
+    StackSet &set = current.sets[block & (Address)(current.cacheSets - 1)];
+
+    // Previous and new access number of the block in this set
+    int &previous = lastAccess[(id * families.size()) + family];
+    int position = set.owner.size() + 1;
+
+    // Block was used before: count blocks used since then
+    if(previous > 0) {
+        // Stack Distance = 1's after previous access number
+        int distance = 0;
+        for(int i = position - 1; i > 0; i -= (i & -i)) {
+            distance += set.tree[i];
+        }
+        for(int i = previous; i > 0; i -= (i & -i)) {
+            distance -= set.tree[i];
+        }
+
+        // Add to histogram (Larger distances miss in every cache of the family)
+        if(distance > current.maxWays) {
+            distance = current.maxWays;
+        }
+        current.histogram[distance]++;
+
+        // Clear the previous access number
+        for(int i = previous; i < position; i += (i & -i)) {
+            set.tree[i]--;
+        }
+        set.owner[previous - 1] = -1;
+    }
+    // First use of the block in this set
+    else {
+        set.liveBlocks++;
+    }
+
+    // Append new access number with a 1 (Fenwick node covers (position - lowbit, position])
+    int node = 1;
+    for(int i = position - 1; i > 0; i -= (i & -i)) {
+        node += set.tree[i];
+    }
+    for(int i = position - (position & -position); i > 0; i -= (i & -i)) {
+        node -= set.tree[i];
+    }
+    set.tree.push_back(node);
+    set.owner.push_back(id);
+    previous = position;
+
+    // Compact when most access numbers are stale
+    if((int)set.owner.size() >= (2 * set.liveBlocks) + 64) {
+        Compact(family, set);
+    }
+}
+
+/****************************************************************************************
+ * Function Name:       Compact
+ * Input Parameters:    int family - represents the family of the set
+ *                      StackSet &set - represents the set to compact
+ * Return Value:        void
+ * Purpose:             Renumbers the set's latest accesses 1, 2, 3, ... in the same
+ *                      order and rebuilds the Fenwick tree. Every remaining access
+ *                      number holds a 1, so each tree node equals its range length.
+ ***************************************************************************************/
+void StackDistance::Compact(int family, StackSet &set) {
+    // Declare number of kept access numbers
+    int kept = 0;
+
+    // Keep only access numbers that are still a block's latest access
+    for(int i=0; i < (int)set.owner.size(); i++) {
+        if(set.owner[i] >= 0) {
+            set.owner[kept] = set.owner[i];
+            kept++;
+            lastAccess[(set.owner[i] * families.size()) + family] = kept;
+        }
+    }
+    set.owner.resize(kept);
+
+    // Rebuild Fenwick tree of all 1's
+    set.tree.resize(kept + 1);
+    for(int i=1; i <= kept; i++) {
+        set.tree[i] = (i & -i);
+    }
+}
+
+#endif
\ No newline at end of file
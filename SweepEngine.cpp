@@ -0,0 +1,433 @@
+/****************************************************************************************
+ *  Memory Simulator: "SweepEngine.cpp"
+ *
+ *  Author:     Hannah Perkins
+ *  CWID:       11472559
+ *  Assignment: Lab #7
+ *
+ *  Date:       17 October 2026
+ *  Course:     ECE 487
+ *
+ *  Function:   Simulates many cache configurations against one trace in one pass
+ *
+ *  Description: Sweep Engine Class that reads a list of cache configurations (cache
+ *          size, block size, associativity, replacement policy) and runs all of them
+ *          against the same trace file. The trace is read and decoded only once, in
+ *          chunks that every configuration shares. The configurations are divided
+ *          among worker threads, and each worker owns the Cache Engines of its
+ *          configurations, so no cache state is shared between threads. While the
+ *          workers simulate one chunk, the main thread decodes the next one.
+ *
+ *          Sweep configuration file format, one configuration per line:
+ *
+ *              <cache size> <block size> <associativity> <policy letter>
+ *
+ *          Policy letters are those of the address table prompt (L = LRU, F = FIFO,
+ *          P = tree PLRU, S = SRRIP, B = BRRIP, R = random, U = LFU). OPT is not
+ *          allowed, since it needs the whole trace before the first access. Empty
+ *          lines and lines starting with '#' are skipped.
+ *
+ ***************************************************************************************/
+
+#ifndef SWEEPENGINE_CPP
+#define SWEEPENGINE_CPP
+
+#include "CacheEngine.h"
+#include "TraceReader.cpp"
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+using namespace std;
+
+// Number of memory accesses decoded per shared chunk
+const int SWEEP_CHUNK_SIZE = 1 << 20;
+
+/****************************************************************************************
+ * Struct Name:         SweepConfig
+ * Purpose:             Holds one cache configuration of the sweep and its results
+ ***************************************************************************************/
+struct SweepConfig {
+    // Configuration
+    int cacheSize;
+    int blockSize;
+    int mappingAssociation;
+    int replacementPolicy;
+
+    // Results
+    long long totalAccesses;
+    long long totalHits;
+};
+
+/****************************************************************************************
+ * Class Name:          SweepEngine
+ * Purpose:             Runs a list of cache configurations against one trace, sharing
+ *                      the trace decode and simulating configurations in parallel
+ ***************************************************************************************/
+class SweepEngine {
+    public:
+        SweepEngine();                              // Constructor
+
+        // User Functions
+        bool ReadConfigFile(string fileName);
+        void AddConfig(int cacheSize, int blockSize, int mappingAssociation,
+                int replacementPolicy);
+        bool Run(string traceFile, Address mainMemorySize);
+        void Print();
+
+        // Getter Functions
+        int GetSize();
+        int GetThreads();
+        long long GetBytes();
+
+    private:
+        // Configurations and their Results
+        vector<SweepConfig> configs;
+        Address mainMemorySize;
+        int threads;
+        long long bytes;
+
+        // Shared Chunk Handed to the Workers
+        const vector<TraceRecord>* chunk;
+        int generation;
+        int workersBusy;
+        bool finished;
+        mutex chunkMutex;
+        condition_variable chunkReady;
+        condition_variable chunkDone;
+
+        // Helper Functions
+        void Worker(int worker);
+};
+
+/****************************************************************************************
+ * Constructor
+ ***************************************************************************************/
+SweepEngine::SweepEngine() {
+    // No configurations or chunk yet
+    mainMemorySize = 0;
+    threads = 0;
+    bytes = 0;
+    chunk = NULL;
+    generation = 0;
+    workersBusy = 0;
+    finished = false;
+}
+
+/****************************************************************************************
+ * Function Name:       ReadConfigFile
+ * Input Parameters:    string - represents the name of the sweep configuration file
+ * Return Value:        bool - represents whether the file was opened (1) or not (0)
+ * Purpose:             Reads one configuration per line: cache size, block size,
+ *                      associativity, and replacement policy letter. Skips empty
+ *                      lines, lines starting with '#', OPT configurations, and
+ *                      geometries the Cache Engine cannot simulate.
+ ***************************************************************************************/
+bool SweepEngine::ReadConfigFile(string fileName) {
+    // Temporary Variables for each Line
+    string line;
+    int cacheSize;
+    int blockSize;
+    int mappingAssociation;
+    char policy;
+
+    // Open File
+    ifstream file (fileName);
+    if(!file.is_open()) {
+        return false;
+    }
+
+    // Read Line by Line of File
+    while(getline(file, line)) {
+        // Skip empty lines and comments
+        if((line.length() == 0) || (line.at(0) == '#') || (line.at(0) == '\r')) {
+            continue;
+        }
+
+        // Parse configuration and add it to the sweep
+        istringstream fields(line);
+        if(fields >> cacheSize >> blockSize >> mappingAssociation >> policy) {
+            // OPT cannot be streamed
+            if(ParsePolicy(policy) == OPT_POLICY) {
+                cout << "Skipping OPT configuration (needs the whole trace): " << line << endl;
+                continue;
+            }
+
+            // Geometry must be one the Cache Engine can simulate
+            string problem = CacheEngine::CheckGeometry(cacheSize, blockSize, mappingAssociation);
+            if(problem.length() != 0) {
+                cout << "Skipping configuration (" << problem << "): " << line << endl;
+                continue;
+            }
+            AddConfig(cacheSize, blockSize, mappingAssociation, ParsePolicy(policy));
+        }
+    }
+
+    // Close File
+    file.close();
+
+    return true;
+}
+
+/****************************************************************************************
+ * Function Name:       AddConfig
+ * Input Parameters:    int cacheSize - represents the size of the cache in bytes
+ *                      int blockSize - represents the block size in bytes
+ *                      int mappingAssociation - represents the N of N-way mapping
+ *                      int replacementPolicy - represents the replacement policy
+ *                      (see "ReplacementPolicy.h")
+ * Return Value:        void
+ * Purpose:             Adds one cache configuration to the sweep
+ ***************************************************************************************/
+void SweepEngine::AddConfig(int cacheSize, int blockSize, int mappingAssociation,
+        int replacementPolicy) {
+    // Declare new configuration with no results yet
+    SweepConfig config;
+    config.cacheSize = cacheSize;
+    config.blockSize = blockSize;
+    config.mappingAssociation = mappingAssociation;
+    config.replacementPolicy = replacementPolicy;
+    config.totalAccesses = 0;
+    config.totalHits = 0;
+
+    // Add to list of configurations
+    configs.push_back(config);
+}
+
+/****************************************************************************************
+ * Function Name:       Run
+ * Input Parameters:    string traceFile - represents the name of the trace file
+ *                      Address mainMemorySize - represents the size of main memory in
+ *                      bytes (0 = 2^64)
+ * Return Value:        bool - represents whether the trace was opened (1) or not (0)
+ * Purpose:             Starts one worker thread per core (at most one per
+ *                      configuration), then decodes the trace chunk by chunk. Each
+ *                      chunk is handed to every worker; while the workers simulate
+ *                      it, the next chunk is decoded into the other buffer.
+ ***************************************************************************************/
+bool SweepEngine::Run(string traceFile, Address mainMemorySize) {
+    // Double buffer of decoded memory accesses
+    vector<TraceRecord> buffers[2];
+    int current = 0;
+
+    // Trace Reader for memory-mapped file
+    TraceReader reader;
+
+    // Nothing decoded yet
+    bytes = 0;
+    threads = 0;
+
+    // Open Trace
+    if(!reader.Open(traceFile)) {
+        return false;
+    }
+
+    // Record how many bytes of trace are decoded
+    bytes = reader.GetFileSize();
+
+    // Nothing to simulate without configurations
+    if(configs.empty()) {
+        reader.Close();
+        return true;
+    }
+
+    // Store main memory size for the workers
+    this->mainMemorySize = mainMemorySize;
+
+    // One thread per core, but no more threads than configurations
+    threads = thread::hardware_concurrency();
+    if(threads < 1) {
+        threads = 1;
+    }
+    if(threads > (int)configs.size()) {
+        threads = configs.size();
+    }
+
+    // Reset shared chunk state
+    chunk = NULL;
+    generation = 0;
+    workersBusy = 0;
+    finished = false;
+
+    // Start Worker Threads
+    vector<thread> workers;
+    for(int i=0; i < threads; i++) {
+        workers.push_back(thread(&SweepEngine::Worker, this, i));
+    }
+
+    // Decode First Chunk
+    buffers[0].reserve(SWEEP_CHUNK_SIZE);
+    buffers[1].reserve(SWEEP_CHUNK_SIZE);
+    reader.NextChunk(buffers[current], SWEEP_CHUNK_SIZE);
+
+    // Hand out chunks until the trace is done
+    while(!buffers[current].empty()) {
+        // Hand current chunk to all workers
+        {
+            lock_guard<mutex> lock(chunkMutex);
+            chunk = &buffers[current];
+            workersBusy = threads;
+            generation++;
+        }
+        chunkReady.notify_all();
+
+        // Decode next chunk while the workers simulate
+        reader.NextChunk(buffers[1 - current], SWEEP_CHUNK_SIZE);
+
+        // Wait for every worker to finish the current chunk
+        {
+            unique_lock<mutex> lock(chunkMutex);
+            chunkDone.wait(lock, [this]() { return workersBusy == 0; });
+        }
+
+        // Swap Buffers
+        current = 1 - current;
+    }
+
+    // Tell workers the trace is done
+    {
+        lock_guard<mutex> lock(chunkMutex);
+        finished = true;
+        generation++;
+    }
+    chunkReady.notify_all();
+
+    // Wait for Worker Threads to store their results
+    for(int i=0; i < threads; i++) {
+        workers[i].join();
+    }
+
+    // Close File
+    reader.Close();
+    return true;
+}
+
+/****************************************************************************************
+ * Function Name:       Print
+ * Input Parameters:    void
+ * Return Value:        void
+ * Purpose:             Prints one row per configuration with its hit rate
+ ***************************************************************************************/
+void SweepEngine::Print() {
+    // Print Column Headers
+    cout << endl << "cache size" << "\t" << "blk size" << "\t" << "n-way" << "\t";
+    cout << "policy" << "\t" << "hits" << "\t\t" << "accesses" << "\t" << "hit rate" << endl;
+    cout << "----------------------------------------------------------------------";
+    cout << "--------------" << endl;
+
+    // Print Rows
+    for(int i=0; i < (int)configs.size(); i++) {
+        // Calculate hit rate
+        double hitRate = 100.0 * ((double)configs[i].totalHits / (double)configs[i].totalAccesses);
+
+        // Print Configuration
+        cout << configs[i].cacheSize << "\t\t" << configs[i].blockSize << "\t\t";
+        cout << configs[i].mappingAssociation << "\t";
+        cout << GetPolicyName(configs[i].replacementPolicy) << "\t";
+
+        // Print Results
+        cout << configs[i].totalHits << "\t\t" << configs[i].totalAccesses << "\t\t";
+        cout << hitRate << "%" << endl;
+    }
+}
+
+/****************************************************************************************
+ * Function Name:       GetSize
+ * Input Parameters:    void
+ * Return Value:        int - represents the number of configurations
+ * Purpose:             Returns the number of configurations in the sweep
+ ***************************************************************************************/
+int SweepEngine::GetSize() {
+    // Return number of configurations
+    return configs.size();
+}
+
+/****************************************************************************************
+ * Function Name:       GetThreads
+ * Input Parameters:    void
+ * Return Value:        int - represents the number of worker threads used
+ * Purpose:             Returns how many worker threads the last Run used
+ ***************************************************************************************/
+int SweepEngine::GetThreads() {
+    // Return number of worker threads
+    return threads;
+}
+
+/****************************************************************************************
+ * Function Name:       GetBytes
+ * Input Parameters:    void
+ * Return Value:        long long - represents the number of trace bytes decoded
+ * Purpose:             Returns the size of the trace the last Run decoded
+ ***************************************************************************************/
+long long SweepEngine::GetBytes() {
+    // Return number of bytes decoded
+    return bytes;
+}
+
+/****************************************************************************************
+ * Function Name:       Worker
+ * Input Parameters:    int - represents the worker number
+ * Return Value:        void
+ * Purpose:             Body of a worker thread. The worker owns configurations
+ *                      worker, worker + threads, worker + 2*threads, ... and creates
+ *                      their Cache Engines itself, so the cache state stays private
+ *                      to the thread. For each chunk handed out by Run, every owned
+ *                      engine simulates every access of the chunk. When the trace is
+ *                      done, the worker stores its engines' counters in configs.
+ ***************************************************************************************/
+void SweepEngine::Worker(int worker) {
+    // Private Cache Engines and the configuration each one belongs to
+    vector<CacheEngine> engines;
+    vector<int> owned;
+    int lastGeneration = 0;
+
+    // Create an engine for each owned configuration
+    for(int i = worker; i < (int)configs.size(); i += threads) {
+        owned.push_back(i);
+    }
+    engines.resize(owned.size());
+    for(int i=0; i < (int)owned.size(); i++) {
+        SweepConfig &config = configs[owned[i]];
+        engines[i].SetEngine(mainMemorySize, config.cacheSize, config.blockSize,
+                config.mappingAssociation, config.replacementPolicy);
+    }
+
+    // Simulate chunks until the trace is done
+    while(true) {
+        // Wait for the next chunk
+        const vector<TraceRecord>* records;
+        {
+            unique_lock<mutex> lock(chunkMutex);
+            chunkReady.wait(lock, [&]() { return generation != lastGeneration; });
+            lastGeneration = generation;
+            if(finished) {
+                break;
+            }
+            records = chunk;
+        }
+
+        // Run every owned engine over the chunk
+        for(int i=0; i < (int)engines.size(); i++) {
+            engines[i].AccessChunk(*records);
+        }
+
+        // Report chunk done
+        {
+            lock_guard<mutex> lock(chunkMutex);
+            workersBusy--;
+        }
+        chunkDone.notify_one();
+    }
+
+    // Store Results (Each configuration is written by its owner only)
+    for(int i=0; i < (int)owned.size(); i++) {
+        configs[owned[i]].totalAccesses = engines[i].GetTotalAccesses();
+        configs[owned[i]].totalHits = engines[i].GetTotalHits();
+    }
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,73 @@
+/****************************************************************************************
+ *  Memory Simulator: "TraceConvert.cpp"
+ *
+ *  Author:     Hannah Perkins
+ *  CWID:       11472559
+ *  Assignment: Lab #7
+ *
+ *  Date:       17 October 2026
+ *  Course:     ECE 487
+ *
+ *  Function:   Converts a text trace file into the binary trace format
+ *
+ *  Description:    Stand-alone program that reads a text trace ("R <address>" /
+ *          "W <address>" lines after a line holding the number of accesses) and
+ *          writes the same accesses in the compact binary trace format described in
+ *          "BinaryTrace.cpp". The Memory Simulator recognizes binary traces by their
+ *          header, so the converted file can be entered wherever a text file name
+ *          is asked for.
+ *
+ *          Usage: TraceConvert <text trace file> <binary trace file>
+ *
+ ***************************************************************************************/
+
+#include "TraceReader.cpp"
+#include <iostream>
+using namespace std;
+
+/*******************************************************************************
+ * --------------------- MAIN -------------------------------------------------
+ ******************************************************************************/
+int main(int argc, char* argv[]) {
+    // Temporary Variables for each Memory Access
+    bool isWrite;
+    Address address;
+
+    // Check for both file names
+    if(argc != 3) {
+        cout << "Usage: " << argv[0] << " <text trace file> <binary trace file>" << endl;
+        return 1;
+    }
+
+    // Open Text Trace
+    TraceReader reader;
+    if(!reader.Open(argv[1])) {
+        cout << "Unable to open file: " << argv[1] << endl;
+        return 1;
+    }
+
+    // Create Binary Trace
+    BinaryTraceWriter writer;
+    if(!writer.Open(argv[2])) {
+        cout << "Unable to create file: " << argv[2] << endl;
+        return 1;
+    }
+
+    // Copy each memory access into the binary trace
+    while(reader.Next(isWrite, address)) {
+        writer.Write(isWrite, address);
+    }
+
+    // Print Conversion Summary
+    cout << "Records converted = " << writer.GetRecords() << endl;
+    cout << "Text trace size = " << reader.GetFileSize() << " bytes" << endl;
+    cout << "Binary trace size = " << writer.GetBytesWritten() << " bytes" << endl;
+    cout << "Compression ratio = " << ((double)reader.GetFileSize() / (double)writer.GetBytesWritten());
+    cout << "x" << endl;
+
+    // Close Files (Writes final record count into the header)
+    writer.Close();
+    reader.Close();
+
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,463 @@
+/****************************************************************************************
+ *  Memory Simulator: "TraceGenerator.cpp"
+ *
+ *  Author:     Hannah Perkins
+ *  CWID:       11472559
+ *  Assignment: Lab #7
+ *
+ *  Date:       17 October 2026
+ *  Course:     ECE 487
+ *
+ *  Function:   Generates synthetic memory accesses in memory
+ *
+ *  Description: Trace Generator Class that produces the accesses of a synthetic
+ *          workload one at a time, so they can be simulated without writing a trace
+ *          file. The Trace Reader uses it when it is given a generator spec instead
+ *          of a file name, so a spec can be entered wherever a trace file is asked
+ *          for:
+ *
+ *              gen:<pattern>[,<key>=<value>...]
+ *
+ *          Patterns (every address is inside [base, base + footprint)):
+ *
+ *              sequential  every word in order, wrapping at the footprint
+ *              strided     every stride-th byte in order, wrapping at the footprint
+ *              uniform     a uniformly random word
+ *              zipf        a stride-byte item chosen with probability 1/rank^alpha;
+ *                          ranks are scattered randomly over the footprint
+ *              chase       the next stride-byte node of one random cycle through
+ *                          every node (a linked-list walk)
+ *              mixed       a copy loop: reads walk the first half of the footprint
+ *                          and writes walk the second half, word by word
+ *
+ *          Keys:
+ *
+ *              accesses    number of accesses              (default 1000000)
+ *              footprint   bytes touched                   (default 65536)
+ *              stride      bytes between accesses / item and node size (default 64)
+ *              alpha       Zipf exponent                   (default 1.0)
+ *              writes      percent of accesses that are writes
+ *                          (default 50 for mixed, 0 otherwise)
+ *              seed        random seed                     (default 1)
+ *              base        first address, decimal or 0x hex (default 0; any
+ *                          64-bit address)
+ *
+ *          Example: gen:zipf,accesses=100000000,footprint=1048576,alpha=0.9,seed=7
+ *
+ *          The same spec always generates the same accesses. Zipf and chase keep
+ *          one table entry per item, so their memory grows with footprint/stride;
+ *          every other pattern uses constant memory.
+ *
+ ***************************************************************************************/
+
+#ifndef TRACEGENERATOR_CPP
+#define TRACEGENERATOR_CPP
+
+#include <string>
+#include <sstream>
+#include <vector>
+#include <algorithm>
+#include <math.h>
+#include <stdlib.h>
+#include "Address.h"
+using namespace std;
+
+// Generator Patterns
+const int SEQUENTIAL_PATTERN = 0;
+const int STRIDED_PATTERN = 1;
+const int UNIFORM_PATTERN = 2;
+const int ZIPF_PATTERN = 3;
+const int CHASE_PATTERN = 4;
+const int MIXED_PATTERN = 5;
+
+// Prefix that marks a generator spec
+const string GENERATOR_PREFIX = "gen:";
+
+// Bytes per word of the sequential, uniform, and mixed patterns
+const int GENERATOR_WORD_SIZE = 4;
+
+/****************************************************************************************
+ * Class Name:          TraceGenerator
+ * Purpose:             Produces the memory accesses of a synthetic workload
+ ***************************************************************************************/
+class TraceGenerator {
+    public:
+        TraceGenerator();                           // Constructor
+
+        // User Functions
+        bool SetGenerator(string spec);
+        bool Next(bool &isWrite, Address &address);
+
+        // Getter Functions
+        long long GetAccesses();
+
+    private:
+        // Variables Set by User
+        int pattern;
+        long long accesses;
+        int footprint;
+        int stride;
+        double alpha;
+        int writePercent;
+        unsigned long long seed;
+        Address base;
+
+        // Variables Calculated and Set by Program
+        long long generated;
+        unsigned long long state;
+        int items;                          // Stride-byte items in the footprint
+        int position;                       // Next address / item / node
+        int writePosition;                  // Next write address of the mixed pattern
+        vector<double> zipfKeep;            // Chance a drawn rank is kept (alias table)
+        vector<int> zipfAlias;              // Rank used when it is not kept
+        vector<int> itemOrder;              // Item of each Zipf rank / next chase node
+
+        // Helper Functions
+        bool ParseSpec(string spec);
+        void BuildTables();
+        unsigned long long NextRandom64();
+        bool NextIsWrite();
+};
+
+/****************************************************************************************
+ * Constructor
+ ***************************************************************************************/
+TraceGenerator::TraceGenerator() {
+    // Nothing to generate until SetGenerator is called
+    pattern = SEQUENTIAL_PATTERN;
+    accesses = 0;
+    footprint = 0;
+    stride = 0;
+    alpha = 0;
+    writePercent = 0;
+    seed = 0;
+    base = 0;
+    generated = 0;
+    state = 0;
+    items = 0;
+    position = 0;
+    writePosition = 0;
+}
+
+/****************************************************************************************
+ * Function Name:       SetGenerator
+ * Input Parameters:    string - represents the generator spec ("gen:<pattern>,...")
+ * Return Value:        bool - represents whether the spec was understood (1) or not (0)
+ * Purpose:             Reads the pattern and keys of the spec and starts the workload
+ *                      from its first access
+ ***************************************************************************************/
+bool TraceGenerator::SetGenerator(string spec) {
+    // Read the Spec
+    if(!ParseSpec(spec)) {
+        return false;
+    }
+
+    // Start from the first access
+    generated = 0;
+    position = 0;
+    writePosition = 0;
+
+    // Seed the random number generator (State must never be 0)
+    state = (seed * 0x9E3779B97F4A7C15ull) ^ 0xD1B54A32D192ED03ull;
+    if(state == 0) {
+        state = 1;
+    }
+
+    // Zipf ranks and the chase cycle
+    BuildTables();
+
+    return true;
+}
+
+/****************************************************************************************
+ * Function Name:       Next
+ * Input Parameters:    bool &isWrite - set to whether the access is a write operation
+ *                      Address &address - set to the main memory address of the 
+ *                      access
+ * Return Value:        bool - represents whether an access was generated (1) or every
+ *                      access has been generated (0)
+ * Purpose:             Generates the next access of the workload
+ ***************************************************************************************/
+bool TraceGenerator::Next(bool &isWrite, Address &address) {
+    // Check for the end of the workload
+    if(generated >= accesses) {
+        return false;
+    }
+    generated++;
+
+    // Generate the Access
+    switch(pattern) {
+        case SEQUENTIAL_PATTERN:
+        case STRIDED_PATTERN:
+            // Step through the footprint, wrapping at the end
+            address = position;
+            position += (pattern == SEQUENTIAL_PATTERN) ? GENERATOR_WORD_SIZE : stride;
+            if(position >= footprint) {
+                position = 0;
+            }
+            isWrite = NextIsWrite();
+            break;
+        case UNIFORM_PATTERN:
+            // Any word of the footprint
+            address = (NextRandom64() % (footprint / GENERATOR_WORD_SIZE)) *
+                    GENERATOR_WORD_SIZE;
+            isWrite = NextIsWrite();
+            break;
+        case ZIPF_PATTERN: {
+            // Draw a rank, keep it or take its alias, then the rank's item
+            unsigned long long random = NextRandom64();
+            int rank = (int)((random >> 32) % items);
+            double u = (double)(random & 0xFFFFFFFFull) / 4294967296.0;
+            if(u >= zipfKeep[rank]) {
+                rank = zipfAlias[rank];
+            }
+            address = itemOrder[rank] * stride;
+            isWrite = NextIsWrite();
+            break;
+        }
+        case CHASE_PATTERN:
+            // Follow the pointer of the current node
+            address = position * stride;
+            position = itemOrder[position];
+            isWrite = NextIsWrite();
+            break;
+        default: {
+            // Copy Loop: reads from the first half, writes to the second half
+            int half = max(footprint / 2, GENERATOR_WORD_SIZE);
+            isWrite = NextIsWrite();
+            int &walk = isWrite ? writePosition : position;
+            address = walk + (isWrite ? half : 0);
+            walk += GENERATOR_WORD_SIZE;
+            if(walk >= half) {
+                walk = 0;
+            }
+            break;
+        }
+    }
+
+    // Move the footprint to its first address
+    address += base;
+
+    return true;
+}
+
+/****************************************************************************************
+ * Function Name:       GetAccesses
+ * Input Parameters:    void
+ * Return Value:        long long - represents the number of accesses in the workload
+ * Purpose:             Returns the accesses key of the spec
+ ***************************************************************************************/
+long long TraceGenerator::GetAccesses() {
+    // Return accesses
+    return accesses;
+}
+
+/****************************************************************************************
+ * Function Name:       ParseSpec
+ * Input Parameters:    string - represents the generator spec
+ * Return Value:        bool - represents whether the spec was understood
+ * Purpose:             Sets the pattern and every key from the spec. Keys not in the
+ *                      spec keep their defaults; an unknown pattern or key, or a value
+ *                      out of range, makes the spec invalid.
+ ***************************************************************************************/
+bool TraceGenerator::ParseSpec(string spec) {
+    // Temporary Variables for each Field
+    string field;
+    bool writesGiven = false;
+
+    // Spec must start with the prefix
+    if(spec.compare(0, GENERATOR_PREFIX.length(), GENERATOR_PREFIX) != 0) {
+        return false;
+    }
+
+    // Defaults
+    accesses = 1000000;
+    footprint = 65536;
+    stride = 64;
+    alpha = 1.0;
+    writePercent = 0;
+    seed = 1;
+    base = 0;
+
+    // Split fields at commas (The first field is the pattern)
+    istringstream fields (spec.substr(GENERATOR_PREFIX.length()));
+    if(!getline(fields, field, ',')) {
+        return false;
+    }
+
+    // Match Pattern
+    if(field == "sequential")       pattern = SEQUENTIAL_PATTERN;
+    else if(field == "strided")     pattern = STRIDED_PATTERN;
+    else if(field == "uniform")     pattern = UNIFORM_PATTERN;
+    else if(field == "zipf")        pattern = ZIPF_PATTERN;
+    else if(field == "chase")       pattern = CHASE_PATTERN;
+    else if(field == "mixed")       pattern = MIXED_PATTERN;
+    else                            return false;
+
+    // Read "key=value" Fields
+    while(getline(fields, field, ',')) {
+        // Split Key and Value
+        size_t equals = field.find('=');
+        if(equals == string::npos) {
+            return false;
+        }
+        string key = field.substr(0, equals);
+        string value = field.substr(equals + 1);
+        char* end;
+
+        // Base is a whole 64-bit address (A double would round it)
+        if(key == "base") {
+            base = strtoull(value.c_str(), &end, 0);
+            if((value.length() == 0) || (*end != '\0')) {
+                return false;
+            }
+            continue;
+        }
+
+        // Convert Value, requiring the whole value to be a number
+        double number = strtod(value.c_str(), &end);
+        if((value.length() == 0) || (*end != '\0') || (number < 0)) {
+            return false;
+        }
+
+        // Apply Key
+        if(key == "accesses")           accesses = (long long)number;
+        else if(key == "footprint")     footprint = (int)min(number, 2147483647.0);
+        else if(key == "stride")        stride = (int)min(number, 2147483647.0);
+        else if(key == "alpha")         alpha = number;
+        else if(key == "seed")          seed = (unsigned long long)number;
+        else if(key == "writes") {
+            writePercent = (int)min(number, 100.0);
+            writesGiven = true;
+        }
+        else {
+            return false;
+        }
+    }
+
+    // The mixed pattern writes half the time unless told otherwise
+    if((pattern == MIXED_PATTERN) && !writesGiven) {
+        writePercent = 50;
+    }
+
+    // Footprint must hold at least one word, and one item of the stride patterns
+    bool usesStride = (pattern == STRIDED_PATTERN) || (pattern == ZIPF_PATTERN) ||
+            (pattern == CHASE_PATTERN);
+    return (stride > 0) && (footprint >= GENERATOR_WORD_SIZE) &&
+            (!usesStride || (footprint >= stride));
+}
+
+/****************************************************************************************
+ * Function Name:       BuildTables
+ * Input Parameters:    void
+ * Return Value:        void
+ * Purpose:             Builds the Zipf alias table (Vose's method, so a rank is drawn
+ *                      in constant time) and a random item for each rank, or the 
+ *                      random cycle of the chase pattern (Sattolo's shuffle, so every
+ *                      node is visited before any repeats).
+ ***************************************************************************************/
+void TraceGenerator::BuildTables() {
+    // Stride-byte Items in the footprint
+    items = footprint / stride;
+    zipfKeep.clear();
+    zipfAlias.clear();
+    itemOrder.clear();
+
+    // Zipf: probability of rank r is 1/r^alpha, items shuffled among ranks
+    if(pattern == ZIPF_PATTERN) {
+        // Weight of each rank, scaled so the average weight is 1
+        zipfKeep.resize(items);
+        zipfAlias.resize(items);
+        double total = 0;
+        for(int r=0; r < items; r++) {
+            zipfKeep[r] = 1.0 / pow((double)(r + 1), alpha);
+            total += zipfKeep[r];
+        }
+        vector<int> small;
+        vector<int> large;
+        for(int r=0; r < items; r++) {
+            zipfKeep[r] = zipfKeep[r] * items / total;
+            zipfAlias[r] = r;
+            if(zipfKeep[r] < 1.0) {
+                small.push_back(r);
+            }
+            else {
+                large.push_back(r);
+            }
+        }
+
+        // Pair each light rank with a heavy rank that fills the rest of its slot
+        while((small.size() > 0) && (large.size() > 0)) {
+            int light = small.back();
+            int heavy = large.back();
+            small.pop_back();
+            zipfAlias[light] = heavy;
+            zipfKeep[heavy] -= 1.0 - zipfKeep[light];
+            if(zipfKeep[heavy] < 1.0) {
+                large.pop_back();
+                small.push_back(heavy);
+            }
+        }
+
+        // Ranks left over (Rounding) are always kept
+        for(int i=0; i < (int)large.size(); i++) {
+            zipfKeep[large[i]] = 1.0;
+        }
+        for(int i=0; i < (int)small.size(); i++) {
+            zipfKeep[small[i]] = 1.0;
+        }
+
+        // Fisher-Yates Shuffle of the items
+        itemOrder.resize(items);
+        for(int i=0; i < items; i++) {
+            itemOrder[i] = i;
+        }
+        for(int i = items - 1; i > 0; i--) {
+            swap(itemOrder[i], itemOrder[NextRandom64() % (i + 1)]);
+        }
+    }
+    // Chase: itemOrder holds the next node of each node, one cycle through all
+    else if(pattern == CHASE_PATTERN) {
+        itemOrder.resize(items);
+        for(int i=0; i < items; i++) {
+            itemOrder[i] = i;
+        }
+        for(int i = items - 1; i > 0; i--) {
+            swap(itemOrder[i], itemOrder[NextRandom64() % i]);
+        }
+    }
+}
+
+/****************************************************************************************
+ * Function Name:       NextRandom64
+ * Input Parameters:    void
+ * Return Value:        unsigned long long - represents the next random number
+ * Purpose:             Advances a 64-bit xorshift* generator. Its period is long
+ *                      enough for billions of accesses.
+ ***************************************************************************************/
+unsigned long long TraceGenerator::NextRandom64() {
+    // Shift and xor three times, then scramble the output
+    state ^= state >> 12;
+    state ^= state << 25;
+    state ^= state >> 27;
+    return state * 0x2545F4914F6CDD1Dull;
+}
+
+/****************************************************************************************
+ * Function Name:       NextIsWrite
+ * Input Parameters:    void
+ * Return Value:        bool - represents whether the next access is a write
+ * Purpose:             Picks a write writePercent percent of the time
+ ***************************************************************************************/
+bool TraceGenerator::NextIsWrite() {
+    // Reads only and writes only need no random number
+    if(writePercent == 0) {
+        return false;
+    }
+    if(writePercent == 100) {
+        return true;
+    }
+    return (int)(NextRandom64() % 100) < writePercent;
+}
+
+#endif
\ No newline at end of file
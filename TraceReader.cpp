@@ -0,0 +1,423 @@
+/****************************************************************************************
+ *  Memory Simulator: "TraceReader.cpp"
+ *
+ *  Author:     Hannah Perkins
+ *  CWID:       11472559
+ *  Assignment: Lab #7
+ *
+ *  Date:       17 October 2026
+ *  Course:     ECE 487
+ *
+ *  Function:   Reads memory accesses from a trace file
+ *
+ *  Description: Trace Reader Class that memory-maps the text file of memory accesses
+ *          and parses each "R <address>" / "W <address>" record in place. No strings
+ *          are created while parsing, so reading a record never allocates memory.
+ *          Files in the binary trace format (see "BinaryTrace.cpp") are recognized 
+ *          by their header and decoded directly. A generator spec ("gen:zipf,...",
+ *          see "TraceGenerator.cpp") can be given instead of a file name, in which
+ *          case the accesses are generated in memory and no file is read.
+ *          Text addresses may be decimal or hex ("0x7ffd5a10"); either way they are
+ *          read as 64-bit addresses.
+ *          The reader also reports the size of the mapped file so the caller can
+ *          report parse throughput.
+ *
+ ***************************************************************************************/
+
+#ifndef TRACEREADER_CPP
+#define TRACEREADER_CPP
+
+#include "BinaryTrace.cpp"
+#include "TraceGenerator.cpp"
+#include "TraceRecord.h"
+#include <string>
+#include <string.h>
+#include <vector>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+using namespace std;
+
+// Largest trace size GetSize reports (Longer counts are clamped to it)
+const int MAX_TRACE_SIZE = 2147483647;
+
+/****************************************************************************************
+ * Class Name:          TraceReader
+ * Purpose:             Memory-maps a trace file and parses one memory access at a time
+ ***************************************************************************************/
+class TraceReader {
+    public:
+        TraceReader();                              // Constructor
+        ~TraceReader();                             // Destructor
+
+        // User Functions
+        bool Open(string fileName);
+        bool Next(bool &isWrite, Address &address);
+        int NextChunk(vector<TraceRecord> &chunk, int maxRecords);
+        void Close();
+
+        // Getter Functions
+        int GetSize();
+        long long GetFileSize();
+        bool GetIsBinary();
+        bool GetIsGenerated();
+
+    private:
+        // Mapped File
+        int fileDescriptor;
+        const char* begin;
+        const char* end;
+        const char* current;
+
+        // Variables Read from File Header
+        int size;
+        bool isBinary;
+
+        // Previous address of a binary trace (Addresses are delta-encoded)
+        Address previousAddress;
+
+        // Generator used instead of a file for a generator spec
+        TraceGenerator generator;
+        bool isGenerated;
+
+        // Helper Functions
+        void SkipWhitespace();
+        unsigned long long ReadNumber();
+        bool NextBinary(bool &isWrite, Address &address);
+};
+
+/****************************************************************************************
+ * Constructor
+ ***************************************************************************************/
+TraceReader::TraceReader() {
+    // Nothing mapped yet
+    fileDescriptor = -1;
+    begin = NULL;
+    end = NULL;
+    current = NULL;
+    size = 0;
+    isBinary = false;
+    previousAddress = 0;
+    isGenerated = false;
+}
+
+/****************************************************************************************
+ * Destructor
+ ***************************************************************************************/
+TraceReader::~TraceReader() {
+    // Unmap the file and close it
+    Close();
+}
+
+/****************************************************************************************
+ * Function Name:       Open
+ * Input Parameters:    string - represents the name of the trace file
+ * Return Value:        bool - represents whether the file was opened (1) or not (0)
+ * Purpose:             Opens and memory-maps the trace file, then reads the first line
+ *                      (or the binary header) to know how many memory accesses there
+ *                      are. After Open, Next returns the memory accesses in order.
+ *                      A generator spec starts the generator instead (no file).
+ ***************************************************************************************/
+bool TraceReader::Open(string fileName) {
+    // Declare struct for file information
+    struct stat fileInfo;
+
+    // Close any previously opened file
+    Close();
+
+    // Generator Spec: generate the accesses instead of reading a file
+    if(fileName.compare(0, GENERATOR_PREFIX.length(), GENERATOR_PREFIX) == 0) {
+        isGenerated = generator.SetGenerator(fileName);
+        size = (int)min(generator.GetAccesses(), (long long)MAX_TRACE_SIZE);
+        return isGenerated;
+    }
+
+    // Open File
+    fileDescriptor = open(fileName.c_str(), O_RDONLY);
+    if(fileDescriptor < 0) {
+        return false;
+    }
+
+    // Get File Size (An empty file has nothing to map)
+    if((fstat(fileDescriptor, &fileInfo) != 0) || (fileInfo.st_size == 0)) {
+        Close();
+        return false;
+    }
+
+    // Map the whole file read-only
+    void* mapped = mmap(NULL, fileInfo.st_size, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+    if(mapped == MAP_FAILED) {
+        Close();
+        return false;
+    }
+
+    // File is read front to back exactly once
+    madvise(mapped, fileInfo.st_size, MADV_SEQUENTIAL);
+
+    // Set pointers to the mapped file
+    begin = (const char*)mapped;
+    end = begin + fileInfo.st_size;
+    current = begin;
+
+    // Check for the binary trace header
+    isBinary = (fileInfo.st_size >= BINARY_TRACE_HEADER_SIZE) && 
+            (memcmp(begin, BINARY_TRACE_MAGIC, 4) == 0) && 
+            ((unsigned char)begin[4] == BINARY_TRACE_VERSION);
+
+    // Binary Trace: read little-endian record count from header
+    if(isBinary) {
+        unsigned long long records = 0;
+        for(int i=0; i < 8; i++) {
+            records = records | ((unsigned long long)(unsigned char)begin[5 + i] << (8 * i));
+        }
+        size = (int)min(records, (unsigned long long)MAX_TRACE_SIZE);
+        previousAddress = 0;
+        current = begin + BINARY_TRACE_HEADER_SIZE;
+    }
+    // Text Trace: read First Line, number of memory accesses
+    else {
+        SkipWhitespace();
+        size = (int)min(ReadNumber(), (unsigned long long)MAX_TRACE_SIZE);
+    }
+
+    return true;
+}
+
+/****************************************************************************************
+ * Function Name:       Next
+ * Input Parameters:    bool &isWrite - set to whether the access is a write operation
+ *                      Address &address - set to the main memory address of the 
+ *                      access
+ * Return Value:        bool - represents whether an access was read (1) or the end of
+ *                      the file was reached (0)
+ * Purpose:             Parses the next "R <address>" or "W <address>" record in place.
+ *                      The address is decimal, or hex with a leading "0x". Empty lines
+ *                      are skipped.
+ ***************************************************************************************/
+bool TraceReader::Next(bool &isWrite, Address &address) {
+    // Generated traces come from the generator
+    if(isGenerated) {
+        return generator.Next(isWrite, address);
+    }
+
+    // Binary traces are decoded instead of parsed
+    if(isBinary) {
+        return NextBinary(isWrite, address);
+    }
+
+    // Skip newlines and empty lines
+    SkipWhitespace();
+
+    // Check for end of file
+    if(current >= end) {
+        return false;
+    }
+
+    // Read First char to determine if operation is read or write
+    isWrite = (*current == 'W');
+    current++;
+
+    // Read address after the operation
+    SkipWhitespace();
+    address = ReadNumber();
+
+    return true;
+}
+
+/****************************************************************************************
+ * Function Name:       NextChunk
+ * Input Parameters:    vector<TraceRecord> &chunk - filled with the decoded accesses
+ *                      int maxRecords - represents the most accesses to decode
+ * Return Value:        int - represents the number of accesses decoded (0 at the end
+ *                      of the file)
+ * Purpose:             Decodes up to maxRecords memory accesses into chunk. The chunk
+ *                      vector keeps its capacity, so reusing it does not allocate.
+ ***************************************************************************************/
+int TraceReader::NextChunk(vector<TraceRecord> &chunk, int maxRecords) {
+    // Temporary Record (A trace does not know next uses)
+    TraceRecord record;
+    record.nextUse = NO_NEXT_USE;
+
+    // Empty the chunk but keep its memory
+    chunk.clear();
+
+    // Decode until chunk is full or file ends
+    while(((int)chunk.size() < maxRecords) && Next(record.isWrite, record.address)) {
+        chunk.push_back(record);
+    }
+
+    // Return number of accesses decoded
+    return chunk.size();
+}
+
+/****************************************************************************************
+ * Function Name:       Close
+ * Input Parameters:    void
+ * Return Value:        void
+ * Purpose:             Unmaps and closes the trace file if one is open
+ ***************************************************************************************/
+void TraceReader::Close() {
+    // Unmap File
+    if(begin != NULL) {
+        munmap((void*)begin, end - begin);
+    }
+
+    // Close File
+    if(fileDescriptor >= 0) {
+        close(fileDescriptor);
+    }
+
+    // Reset to nothing mapped
+    isGenerated = false;
+    fileDescriptor = -1;
+    begin = NULL;
+    end = NULL;
+    current = NULL;
+}
+
+/****************************************************************************************
+ * Function Name:       GetSize
+ * Input Parameters:    void
+ * Return Value:        int - represents the number of memory accesses in the trace
+ * Purpose:             Returns the number read from the first line of the trace (or
+ *                      the binary header), clamped to MAX_TRACE_SIZE so a 64-bit
+ *                      count never turns negative
+ ***************************************************************************************/
+int TraceReader::GetSize() {
+    // Return size
+    return size;
+}
+
+/****************************************************************************************
+ * Function Name:       GetFileSize
+ * Input Parameters:    void
+ * Return Value:        long long - represents the size of the trace file in bytes
+ * Purpose:             Returns the number of bytes in the mapped file. Used to report
+ *                      parse throughput. Generated traces have no file (0 bytes).
+ ***************************************************************************************/
+long long TraceReader::GetFileSize() {
+    // Return number of mapped bytes
+    return end - begin;
+}
+
+/****************************************************************************************
+ * Function Name:       GetIsBinary
+ * Input Parameters:    void
+ * Return Value:        bool - represents whether the file is a binary trace
+ * Purpose:             Returns true if the opened file is in the binary trace format
+ ***************************************************************************************/
+bool TraceReader::GetIsBinary() {
+    // Return isBinary
+    return isBinary;
+}
+
+/****************************************************************************************
+ * Function Name:       GetIsGenerated
+ * Input Parameters:    void
+ * Return Value:        bool - represents whether the trace is generated
+ * Purpose:             Returns true if a generator spec was opened instead of a file
+ ***************************************************************************************/
+bool TraceReader::GetIsGenerated() {
+    // Return isGenerated
+    return isGenerated;
+}
+
+/****************************************************************************************
+ * Function Name:       SkipWhitespace
+ * Input Parameters:    void
+ * Return Value:        void
+ * Purpose:             Moves the current position past spaces, tabs, and newlines
+ *                      (including the '\r' of Windows line endings)
+ ***************************************************************************************/
+void TraceReader::SkipWhitespace() {
+    // Advance while current char is whitespace
+    while((current < end) && ((*current == ' ') || (*current == '\t') ||
+            (*current == '\r') || (*current == '\n'))) {
+        current++;
+    }
+}
+
+/****************************************************************************************
+ * Function Name:       ReadNumber
+ * Input Parameters:    void
+ * Return Value:        unsigned long long - represents the number at the current 
+ *                      position
+ * Purpose:             Converts the digits at the current position into an integer
+ *                      and moves the current position past them. A leading "0x" 
+ *                      reads the digits as hex, as 64-bit traces are often written.
+ ***************************************************************************************/
+unsigned long long TraceReader::ReadNumber() {
+    // Declare number, starting at 0
+    unsigned long long number = 0;
+
+    // Hex Number: accumulate each hex digit after the "0x"
+    if(((end - current) > 2) && (current[0] == '0') && ((current[1] | 0x20) == 'x')) {
+        current += 2;
+        while(current < end) {
+            char digit = *current | 0x20;
+            if((*current >= '0') && (*current <= '9')) {
+                number = (number << 4) + (*current - '0');
+            }
+            else if((digit >= 'a') && (digit <= 'f')) {
+                number = (number << 4) + (digit - 'a' + 10);
+            }
+            else {
+                break;
+            }
+            current++;
+        }
+        return number;
+    }
+
+    // Accumulate each decimal digit
+    while((current < end) && (*current >= '0') && (*current <= '9')) {
+        number = (number * 10) + (*current - '0');
+        current++;
+    }
+
+    // Return number
+    return number;
+}
+
+/****************************************************************************************
+ * Function Name:       NextBinary
+ * Input Parameters:    bool &isWrite - set to whether the access is a write operation
+ *                      Address &address - set to the main memory address of the 
+ *                      access
+ * Return Value:        bool - represents whether an access was read (1) or the end of
+ *                      the file was reached (0)
+ * Purpose:             Decodes the next varint record of a binary trace. The first 
+ *                      byte holds the read/write bit and 6 bits of the zigzag delta;
+ *                      each following byte holds 7 more bits.
+ ***************************************************************************************/
+bool TraceReader::NextBinary(bool &isWrite, Address &address) {
+    // Check for end of file
+    if(current >= end) {
+        return false;
+    }
+
+    // First byte: read/write bit and lowest 6 bits of the zigzag delta
+    unsigned char nextByte = (unsigned char)*current++;
+    isWrite = (nextByte & 1);
+    unsigned long long value = (nextByte >> 1) & 0x3F;
+    int shift = 6;
+
+    // Following bytes: 7 bits each while the high bit is set
+    while((nextByte & 0x80) && (current < end)) {
+        nextByte = (unsigned char)*current++;
+        if(shift < 64) {
+            value = value | ((unsigned long long)(nextByte & 0x7F) << shift);
+        }
+        shift += 7;
+    }
+
+    // Undo zigzag and add delta to the previous address
+    long long delta = (long long)(value >> 1) ^ -(long long)(value & 1);
+    previousAddress = previousAddress + (unsigned long long)delta;
+    address = previousAddress;
+
+    return true;
+}
+
+#endif
\ No newline at end of file
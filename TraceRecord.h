@@ -0,0 +1,38 @@
+/****************************************************************************************
+ *  Memory Simulator: "TraceRecord.h"
+ *
+ *  Author:     Hannah Perkins
+ *  CWID:       11472559
+ *  Assignment: Lab #7
+ *
+ *  Date:       17 October 2026
+ *  Course:     ECE 487
+ *
+ *  Function:   Defines one decoded memory access
+ *
+ *  Description: Trace Record Struct shared by the Trace Reader, which decodes chunks
+ *          of a trace into records, and the Cache Engine, which simulates a whole
+ *          chunk of records at once. A record read from a trace has no next use
+ *          (NO_NEXT_USE); records built from the Address Table carry the row of
+ *          the block's next access for OPT.
+ *
+ ***************************************************************************************/
+
+#ifndef TRACERECORD_H
+#define TRACERECORD_H
+
+#include "Address.h"
+#include "OptimalPolicy.h"
+
+/****************************************************************************************
+ * Struct Name:         TraceRecord
+ * Purpose:             Holds one decoded memory access so a chunk of the trace can be
+ *                      decoded once and shared by several simulations
+ ***************************************************************************************/
+struct TraceRecord {
+    Address address;
+    bool isWrite;
+    int nextUse;                        // Row of the block's next access (OPT only)
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,415 @@
+/****************************************************************************************
+ *  Memory Simulator: "WayProbe.cpp"
+ *
+ *  Author:     Hannah Perkins
+ *  CWID:       11472559
+ *  Assignment: Lab #7
+ *
+ *  Date:       17 October 2026
+ *  Course:     ECE 487
+ *
+ *  Function:   Searches all ways of a cache set at once
+ *
+ *  Description: Defines the vector versions of ProbeWays and FindLowestWay. On
+ *          x86 with GCC or Clang, SSE2 is always there, and the AVX2 versions are
+ *          compiled for AVX2 alone (target attribute) and used only if the CPU
+ *          reports AVX2 when the program starts, so one build runs everywhere.
+ *          Elsewhere the vector versions call the scalar loops in "WayProbe.h".
+ *
+ *              Ways are compared in groups of 8: the group's tags are compared
+ *          with the tag, its 8 valid bytes are compared with 0, and both results
+ *          become 8-bit masks, so the hit and the first empty way are each found
+ *          with one bit scan. Ways left over after the last group (sets that are
+ *          not a multiple of 8 ways) go through the scalar loop.
+ *
+ ***************************************************************************************/
+
+#include "WayProbe.h"
+using namespace std;
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__)) && defined(__SSE2__)
+#define WAYPROBE_X86
+#include <immintrin.h>
+#endif
+
+// Ways compared per group
+const int PROBE_GROUP_WAYS = 8;
+
+/****************************************************************************************
+ * Function Name:       ProbeRest
+ * Input Parameters:    WayProbe probe - represents what the groups found
+ *                      const Tag* tags - represents the tags of the set's ways
+ *                      const unsigned char* valid - represents the valid bits
+ *                      Tag tag - represents the tag to find
+ *                      int first - represents the first way not in a group
+ *                      int ways - represents the number of ways in the set
+ * Return Value:        WayProbe - represents the hit way and the first empty way
+ * Purpose:             Checks the ways after the last group with the scalar loop
+ ***************************************************************************************/
+template <class Tag>
+static inline WayProbe ProbeRest(WayProbe probe, const Tag* tags, const unsigned char* valid,
+        Tag tag, int first, int ways) {
+    // Scalar loop over the leftover ways
+    WayProbe rest = ProbeWaysScalar(tags + first, valid + first, tag, ways - first);
+    if(rest.hitWay >= 0) {
+        probe.hitWay = first + rest.hitWay;
+    }
+    else if((probe.emptyWay < 0) && (rest.emptyWay >= 0)) {
+        probe.emptyWay = first + rest.emptyWay;
+    }
+
+    return probe;
+}
+
+#ifdef WAYPROBE_X86
+
+/****************************************************************************************
+ * Function Name:       DetectAVX2
+ * Input Parameters:    void
+ * Return Value:        bool - represents whether the CPU (and OS) support AVX2
+ * Purpose:             Asks the CPU once, when the program starts
+ ***************************************************************************************/
+static bool DetectAVX2() {
+    // Must be called before __builtin_cpu_supports during static initialization
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2") != 0;
+}
+
+// Whether the AVX2 versions are used
+static const bool hasAVX2 = DetectAVX2();
+
+/****************************************************************************************
+ * Function Name:       LoadValidMask
+ * Input Parameters:    const unsigned char* - represents the valid bits of a group
+ * Return Value:        unsigned int - represents one bit per way (1 = valid)
+ * Purpose:             Turns the group's 8 valid bytes into a bit mask
+ ***************************************************************************************/
+static inline unsigned int LoadValidMask(const unsigned char* valid) {
+    // Bytes equal to 0 are invalid (The 8 bytes above the group load as 0)
+    __m128i bytes = _mm_loadl_epi64((const __m128i*)valid);
+    __m128i invalid = _mm_cmpeq_epi8(bytes, _mm_setzero_si128());
+    return (~(unsigned int)_mm_movemask_epi8(invalid)) & 0xFF;
+}
+
+/****************************************************************************************
+ * Function Name:       FinishGroup
+ * Input Parameters:    WayProbe &probe - represents what earlier groups found
+ *                      unsigned int matches - represents the ways whose tag matched
+ *                      const unsigned char* valid - represents the valid bits of the
+ *                      group
+ *                      int first - represents the group's first way
+ * Return Value:        bool - represents whether the group held the hit
+ * Purpose:             Records the group's hit, or its first empty way if no earlier
+ *                      group had one
+ ***************************************************************************************/
+static inline bool FinishGroup(WayProbe &probe, unsigned int matches,
+        const unsigned char* valid, int first) {
+    // Only a valid way can hit
+    unsigned int validMask = LoadValidMask(valid);
+    unsigned int hits = matches & validMask;
+    if(hits != 0) {
+        probe.hitWay = first + __builtin_ctz(hits);
+        return true;
+    }
+
+    // Remember the first empty way
+    unsigned int empty = (~validMask) & 0xFF;
+    if((probe.emptyWay < 0) && (empty != 0)) {
+        probe.emptyWay = first + __builtin_ctz(empty);
+    }
+    return false;
+}
+
+/****************************************************************************************
+ * Function Name:       ProbeWaysSSE2
+ * Input Parameters:    const unsigned int* tags - represents the 32-bit tags
+ *                      const unsigned char* valid - represents the valid bits
+ *                      unsigned int tag - represents the tag to find
+ *                      int ways - represents the number of ways in the set
+ * Return Value:        WayProbe - represents the hit way and the first empty way
+ * Purpose:             Compares 4 tags per instruction
+ ***************************************************************************************/
+static WayProbe ProbeWaysSSE2(const unsigned int* tags, const unsigned char* valid,
+        unsigned int tag, int ways) {
+    // Miss in a full set until found otherwise
+    WayProbe probe = { -1, -1 };
+    __m128i key = _mm_set1_epi32((int)tag);
+
+    // Groups of 8 ways (2 compares)
+    int j = 0;
+    for(; j + PROBE_GROUP_WAYS <= ways; j += PROBE_GROUP_WAYS) {
+        __m128i low = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i*)(tags + j)), key);
+        __m128i high = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i*)(tags + j + 4)), key);
+        unsigned int matches = (unsigned int)_mm_movemask_ps(_mm_castsi128_ps(low)) |
+                ((unsigned int)_mm_movemask_ps(_mm_castsi128_ps(high)) << 4);
+        if(FinishGroup(probe, matches, valid + j, j)) {
+            return probe;
+        }
+    }
+
+    // Leftover ways
+    return ProbeRest(probe, tags, valid, tag, j, ways);
+}
+
+/****************************************************************************************
+ * Function Name:       ProbeWaysSSE2
+ * Input Parameters:    const unsigned long long* tags - represents the 64-bit tags
+ *                      const unsigned char* valid - represents the valid bits
+ *                      unsigned long long tag - represents the tag to find
+ *                      int ways - represents the number of ways in the set
+ * Return Value:        WayProbe - represents the hit way and the first empty way
+ * Purpose:             Compares 2 tags per instruction. SSE2 has no 64-bit compare,
+ *                      so both 32-bit halves must match.
+ ***************************************************************************************/
+static WayProbe ProbeWaysSSE2(const unsigned long long* tags, const unsigned char* valid,
+        unsigned long long tag, int ways) {
+    // Miss in a full set until found otherwise
+    WayProbe probe = { -1, -1 };
+    __m128i key = _mm_set1_epi64x((long long)tag);
+
+    // Groups of 8 ways (4 compares)
+    int j = 0;
+    for(; j + PROBE_GROUP_WAYS <= ways; j += PROBE_GROUP_WAYS) {
+        unsigned int matches = 0;
+        for(int k=0; k < PROBE_GROUP_WAYS; k += 2) {
+            __m128i halves = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i*)(tags + j + k)), key);
+            __m128i equal = _mm_and_si128(halves, _mm_shuffle_epi32(halves, _MM_SHUFFLE(2, 3, 0, 1)));
+            matches |= (unsigned int)_mm_movemask_pd(_mm_castsi128_pd(equal)) << k;
+        }
+        if(FinishGroup(probe, matches, valid + j, j)) {
+            return probe;
+        }
+    }
+
+    // Leftover ways
+    return ProbeRest(probe, tags, valid, tag, j, ways);
+}
+
+/****************************************************************************************
+ * Function Name:       ProbeWaysAVX2
+ * Input Parameters:    const unsigned int* tags - represents the 32-bit tags
+ *                      const unsigned char* valid - represents the valid bits
+ *                      unsigned int tag - represents the tag to find
+ *                      int ways - represents the number of ways in the set
+ * Return Value:        WayProbe - represents the hit way and the first empty way
+ * Purpose:             Compares 8 tags per instruction
+ ***************************************************************************************/
+__attribute__((target("avx2")))
+static WayProbe ProbeWaysAVX2(const unsigned int* tags, const unsigned char* valid,
+        unsigned int tag, int ways) {
+    // Miss in a full set until found otherwise
+    WayProbe probe = { -1, -1 };
+    __m256i key = _mm256_set1_epi32((int)tag);
+
+    // Groups of 8 ways (1 compare)
+    int j = 0;
+    for(; j + PROBE_GROUP_WAYS <= ways; j += PROBE_GROUP_WAYS) {
+        __m256i equal = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i*)(tags + j)), key);
+        unsigned int matches = (unsigned int)_mm256_movemask_ps(_mm256_castsi256_ps(equal));
+        if(FinishGroup(probe, matches, valid + j, j)) {
+            return probe;
+        }
+    }
+
+    // Leftover ways
+    return ProbeRest(probe, tags, valid, tag, j, ways);
+}
+
+/****************************************************************************************
+ * Function Name:       ProbeWaysAVX2
+ * Input Parameters:    const unsigned long long* tags - represents the 64-bit tags
+ *                      const unsigned char* valid - represents the valid bits
+ *                      unsigned long long tag - represents the tag to find
+ *                      int ways - represents the number of ways in the set
+ * Return Value:        WayProbe - represents the hit way and the first empty way
+ * Purpose:             Compares 4 tags per instruction
+ ***************************************************************************************/
+__attribute__((target("avx2")))
+static WayProbe ProbeWaysAVX2(const unsigned long long* tags, const unsigned char* valid,
+        unsigned long long tag, int ways) {
+    // Miss in a full set until found otherwise
+    WayProbe probe = { -1, -1 };
+    __m256i key = _mm256_set1_epi64x((long long)tag);
+
+    // Groups of 8 ways (2 compares)
+    int j = 0;
+    for(; j + PROBE_GROUP_WAYS <= ways; j += PROBE_GROUP_WAYS) {
+        __m256i low = _mm256_cmpeq_epi64(_mm256_loadu_si256((const __m256i*)(tags + j)), key);
+        __m256i high = _mm256_cmpeq_epi64(_mm256_loadu_si256((const __m256i*)(tags + j + 4)), key);
+        unsigned int matches = (unsigned int)_mm256_movemask_pd(_mm256_castsi256_pd(low)) |
+                ((unsigned int)_mm256_movemask_pd(_mm256_castsi256_pd(high)) << 4);
+        if(FinishGroup(probe, matches, valid + j, j)) {
+            return probe;
+        }
+    }
+
+    // Leftover ways
+    return ProbeRest(probe, tags, valid, tag, j, ways);
+}
+
+/****************************************************************************************
+ * Function Name:       FoldLanes
+ * Input Parameters:    __m256i &values - represents 4 lanes of lowest values, set to
+ *                      the lower of each pair
+ *                      __m256i &ways - represents the ways of those values
+ *                      __m256i otherValues - represents the 4 lanes to compare with
+ *                      __m256i otherWays - represents the ways of the other values
+ * Return Value:        void
+ * Purpose:             Keeps, lane by lane, the lower value and its way (the lower
+ *                      way when the values tie) without a branch
+ ***************************************************************************************/
+__attribute__((target("avx2")))
+static inline void FoldLanes(__m256i &values, __m256i &ways, __m256i otherValues,
+        __m256i otherWays) {
+    // Other lane is lower, or the same value in an earlier way
+    __m256i takes = _mm256_or_si256(_mm256_cmpgt_epi64(values, otherValues),
+            _mm256_and_si256(_mm256_cmpeq_epi64(values, otherValues),
+            _mm256_cmpgt_epi64(ways, otherWays)));
+    values = _mm256_blendv_epi8(values, otherValues, takes);
+    ways = _mm256_blendv_epi8(ways, otherWays, takes);
+}
+
+/****************************************************************************************
+ * Function Name:       FindLowestWayAVX2
+ * Input Parameters:    const long long* values - represents the value of each way
+ *                      int ways - represents the number of ways in the set
+ * Return Value:        int - represents the first way with the lowest value
+ * Purpose:             Keeps, in each of 8 lanes, the lowest value seen and its way
+ *                      (two registers of 4, so two chains of compares run side by
+ *                      side), then folds the 8 lanes down to the lowest. A lane only
+ *                      takes a strictly lower value, so ties keep the first way. No
+ *                      step branches on the values, so random ages cost no
+ *                      mispredictions.
+ ***************************************************************************************/
+__attribute__((target("avx2")))
+static int FindLowestWayAVX2(const long long* values, int ways) {
+    // Too few ways for a group
+    if(ways < PROBE_GROUP_WAYS) {
+        return FindLowestWayScalar(values, ways);
+    }
+
+    // First group: every lane holds its own way
+    __m256i low = _mm256_loadu_si256((const __m256i*)values);
+    __m256i high = _mm256_loadu_si256((const __m256i*)(values + 4));
+    __m256i lowWay = _mm256_setr_epi64x(0, 1, 2, 3);
+    __m256i highWay = _mm256_setr_epi64x(4, 5, 6, 7);
+    __m256i step = _mm256_set1_epi64x(PROBE_GROUP_WAYS);
+    __m256i nextLowWay = lowWay;
+    __m256i nextHighWay = highWay;
+
+    // Later groups: a lane takes the group's value and way where it is lower
+    int j = PROBE_GROUP_WAYS;
+    for(; j + PROBE_GROUP_WAYS <= ways; j += PROBE_GROUP_WAYS) {
+        nextLowWay = _mm256_add_epi64(nextLowWay, step);
+        nextHighWay = _mm256_add_epi64(nextHighWay, step);
+        __m256i first = _mm256_loadu_si256((const __m256i*)(values + j));
+        __m256i second = _mm256_loadu_si256((const __m256i*)(values + j + 4));
+        __m256i lowTakes = _mm256_cmpgt_epi64(low, first);
+        __m256i highTakes = _mm256_cmpgt_epi64(high, second);
+        low = _mm256_blendv_epi8(low, first, lowTakes);
+        high = _mm256_blendv_epi8(high, second, highTakes);
+        lowWay = _mm256_blendv_epi8(lowWay, nextLowWay, lowTakes);
+        highWay = _mm256_blendv_epi8(highWay, nextHighWay, highTakes);
+    }
+
+    // Fold the 8 lanes to 1: the two registers, the two halves, then the two pairs
+    FoldLanes(low, lowWay, high, highWay);
+    FoldLanes(low, lowWay, _mm256_permute4x64_epi64(low, _MM_SHUFFLE(1, 0, 3, 2)),
+            _mm256_permute4x64_epi64(lowWay, _MM_SHUFFLE(1, 0, 3, 2)));
+    FoldLanes(low, lowWay, _mm256_shuffle_epi32(low, _MM_SHUFFLE(1, 0, 3, 2)),
+            _mm256_shuffle_epi32(lowWay, _MM_SHUFFLE(1, 0, 3, 2)));
+    long long value;
+    _mm_storel_epi64((__m128i*)&value, _mm256_castsi256_si128(low));
+    int lowest = _mm_cvtsi128_si32(_mm256_castsi256_si128(lowWay));
+
+    // Leftover ways (All later than every lane's way)
+    for(int k=j; k < ways; k++) {
+        bool takes = values[k] < value;
+        value = takes ? values[k] : value;
+        lowest = takes ? k : lowest;
+    }
+
+    return lowest;
+}
+
+#endif
+
+/****************************************************************************************
+ * Function Name:       ProbeWaysVector
+ * Input Parameters:    const unsigned int* tags - represents the 32-bit tags
+ *                      const unsigned char* valid - represents the valid bits
+ *                      unsigned int tag - represents the tag to find
+ *                      int ways - represents the number of ways in the set
+ * Return Value:        WayProbe - represents the hit way and the first empty way
+ * Purpose:             Runs the widest version this CPU supports
+ ***************************************************************************************/
+WayProbe ProbeWaysVector(const unsigned int* tags, const unsigned char* valid,
+        unsigned int tag, int ways) {
+#ifdef WAYPROBE_X86
+    // AVX2 if the CPU has it, SSE2 otherwise
+    if(hasAVX2) {
+        return ProbeWaysAVX2(tags, valid, tag, ways);
+    }
+    return ProbeWaysSSE2(tags, valid, tag, ways);
+#else
+    // No vector version on this machine
+    return ProbeWaysScalar(tags, valid, tag, ways);
+#endif
+}
+
+/****************************************************************************************
+ * Function Name:       ProbeWaysVector
+ * Input Parameters:    const unsigned long long* tags - represents the 64-bit tags
+ *                      const unsigned char* valid - represents the valid bits
+ *                      unsigned long long tag - represents the tag to find
+ *                      int ways - represents the number of ways in the set
+ * Return Value:        WayProbe - represents the hit way and the first empty way
+ * Purpose:             Runs the widest version this CPU supports
+ ***************************************************************************************/
+WayProbe ProbeWaysVector(const unsigned long long* tags, const unsigned char* valid,
+        unsigned long long tag, int ways) {
+#ifdef WAYPROBE_X86
+    // AVX2 if the CPU has it, SSE2 otherwise
+    if(hasAVX2) {
+        return ProbeWaysAVX2(tags, valid, tag, ways);
+    }
+    return ProbeWaysSSE2(tags, valid, tag, ways);
+#else
+    // No vector version on this machine
+    return ProbeWaysScalar(tags, valid, tag, ways);
+#endif
+}
+
+/****************************************************************************************
+ * Function Name:       FindLowestWayVector
+ * Input Parameters:    const long long* values - represents the value of each way
+ *                      int ways - represents the number of ways in the set
+ * Return Value:        int - represents the first way with the lowest value
+ * Purpose:             Runs the AVX2 version if the CPU has it. SSE2 has no 64-bit
+ *                      compare, so the scalar loop is used otherwise.
+ ***************************************************************************************/
+int FindLowestWayVector(const long long* values, int ways) {
+#ifdef WAYPROBE_X86
+    // AVX2 if the CPU has it
+    if(hasAVX2) {
+        return FindLowestWayAVX2(values, ways);
+    }
+#endif
+    return FindLowestWayScalar(values, ways);
+}
+
+/****************************************************************************************
+ * Function Name:       GetProbeInstructionSet
+ * Input Parameters:    void
+ * Return Value:        string - represents the instructions the vector versions use
+ *                      ("avx2", "sse2", or "scalar")
+ * Purpose:             Lets the benchmark label what it measured
+ ***************************************************************************************/
+string GetProbeInstructionSet() {
+#ifdef WAYPROBE_X86
+    // Chosen when the program started
+    return hasAVX2 ? "avx2" : "sse2";
+#else
+    return "scalar";
+#endif
+}
\ No newline at end of file
@@ -0,0 +1,151 @@
+/****************************************************************************************
+ *  Memory Simulator: "WayProbe.h"
+ *
+ *  Author:     Hannah Perkins
+ *  CWID:       11472559
+ *  Assignment: Lab #7
+ *
+ *  Date:       17 October 2026
+ *  Course:     ECE 487
+ *
+ *  Function:   Searches all ways of a cache set at once
+ *
+ *  Description: The Cache Engine's access loop checks every way (line) of a set for
+ *          a valid line with a matching tag, then for an empty line, and a full set
+ *          is searched again for the line with the lowest age. For 16- to 64-way
+ *          caches these scans are most of the work of an access.
+ *
+ *              ProbeWays compares the tag with every way of the set and finds the
+ *          first empty way in the same pass. FindLowestWay returns the first way
+ *          with the lowest value (the LRU and FIFO time clocks, the LFU use
+ *          counts). Each has three versions, giving the same answers:
+ *
+ *              scalar      - one way at a time (always built)
+ *              SSE2        - 4 32-bit or 2 64-bit tags per compare (x86-64)
+ *              AVX2        - 8 32-bit or 4 64-bit tags per compare, and the
+ *                            lowest age search; used only when the CPU has AVX2
+ *
+ *          Sets of fewer than PROBE_VECTOR_WAYS ways (LOWEST_VECTOR_WAYS for
+ *          FindLowestWay) stay on the inline scalar loop, which is already a
+ *          handful of compares. Wider sets call the vector version in
+ *          "WayProbe.cpp", which picks AVX2 or SSE2 once, when the program starts.
+ *
+ ***************************************************************************************/
+
+#ifndef WAYPROBE_H
+#define WAYPROBE_H
+
+#include <string>
+using namespace std;
+
+// Fewest ways of a set searched with vector instructions (Below these, the call to
+// the vector version costs more than the scalar loop saves)
+const int PROBE_VECTOR_WAYS = 16;
+const int LOWEST_VECTOR_WAYS = 32;
+
+/****************************************************************************************
+ * Struct Name:         WayProbe
+ * Purpose:             Holds what one pass over a set found
+ ***************************************************************************************/
+struct WayProbe {
+    int hitWay;                 // Valid way with the tag, or -1 (miss)
+    int emptyWay;               // First invalid way, or -1 (full set). Only used on a miss
+};
+
+// Vector Versions (Defined in "WayProbe.cpp")
+WayProbe ProbeWaysVector(const unsigned int* tags, const unsigned char* valid,
+        unsigned int tag, int ways);
+WayProbe ProbeWaysVector(const unsigned long long* tags, const unsigned char* valid,
+        unsigned long long tag, int ways);
+int FindLowestWayVector(const long long* values, int ways);
+string GetProbeInstructionSet();
+
+/****************************************************************************************
+ * Function Name:       ProbeWaysScalar
+ * Input Parameters:    const Tag* tags - represents the tags of the set's ways
+ *                      const unsigned char* valid - represents the valid bits of the
+ *                      set's ways (0 = invalid)
+ *                      Tag tag - represents the tag to find
+ *                      int ways - represents the number of ways in the set
+ * Return Value:        WayProbe - represents the hit way and the first empty way
+ * Purpose:             Checks the ways one at a time. Stops at the hit, since the
+ *                      empty way is only needed on a miss.
+ ***************************************************************************************/
+template <class Tag>
+inline WayProbe ProbeWaysScalar(const Tag* tags, const unsigned char* valid, Tag tag,
+        int ways) {
+    // Miss in a full set until found otherwise
+    WayProbe probe = { -1, -1 };
+
+    // Check each way
+    for(int j=0; j < ways; j++) {
+        if(valid[j]) {
+            if(tags[j] == tag) {
+                probe.hitWay = j;
+                return probe;
+            }
+        }
+        else if(probe.emptyWay < 0) {
+            probe.emptyWay = j;
+        }
+    }
+
+    return probe;
+}
+
+/****************************************************************************************
+ * Function Name:       ProbeWays
+ * Input Parameters:    const Tag* tags - represents the tags of the set's ways
+ *                      const unsigned char* valid - represents the valid bits of the
+ *                      set's ways (0 = invalid)
+ *                      Tag tag - represents the tag to find
+ *                      int ways - represents the number of ways in the set
+ * Return Value:        WayProbe - represents the hit way and the first empty way
+ * Purpose:             Uses the vector version for wide sets, the scalar loop
+ *                      otherwise
+ ***************************************************************************************/
+template <class Tag>
+inline WayProbe ProbeWays(const Tag* tags, const unsigned char* valid, Tag tag, int ways) {
+    // Wide set: compare several ways per instruction
+    if(ways >= PROBE_VECTOR_WAYS) {
+        return ProbeWaysVector(tags, valid, tag, ways);
+    }
+    return ProbeWaysScalar(tags, valid, tag, ways);
+}
+
+/****************************************************************************************
+ * Function Name:       FindLowestWayScalar
+ * Input Parameters:    const long long* values - represents the value of each way
+ *                      int ways - represents the number of ways in the set
+ * Return Value:        int - represents the first way with the lowest value
+ * Purpose:             Checks the ways one at a time
+ ***************************************************************************************/
+inline int FindLowestWayScalar(const long long* values, int ways) {
+    // Lower value wins, ties go to the lowest way
+    int lowest = 0;
+    for(int j=1; j < ways; j++) {
+        if(values[j] < values[lowest]) {
+            lowest = j;
+        }
+    }
+
+    return lowest;
+}
+
+/****************************************************************************************
+ * Function Name:       FindLowestWay
+ * Input Parameters:    const long long* values - represents the value of each way
+ *                      int ways - represents the number of ways in the set
+ * Return Value:        int - represents the first way with the lowest value
+ * Purpose:             Uses the vector version for wide sets, the scalar loop
+ *                      otherwise
+ ***************************************************************************************/
+inline int FindLowestWay(const long long* values, int ways) {
+    // Wide set: compare several ways per instruction
+    if(ways >= LOWEST_VECTOR_WAYS) {
+        return FindLowestWayVector(values, ways);
+    }
+    return FindLowestWayScalar(values, ways);
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,159 @@
+/****************************************************************************************
+ *  Memory Simulator: "WriteBuffer.cpp"
+ *
+ *  Author:     Hannah Perkins
+ *  CWID:       11472559
+ *  Assignment: Lab #7
+ *
+ *  Date:       17 October 2026
+ *  Course:     ECE 487
+ *
+ *  Function:   Simulates a coalescing write buffer between a cache and the next level
+ *
+ *  Description: Defines the WriteBuffer functions. Only GetEntries, which the Cache
+ *          Engine checks on every write to the next level, is inline in 
+ *          "WriteBuffer.h".
+ *
+ ***************************************************************************************/
+
+#include "WriteBuffer.h"
+using namespace std;
+
+/****************************************************************************************
+ * Constructor
+ ***************************************************************************************/
+WriteBuffer::WriteBuffer() {
+    // No buffer until SetBuffer is called
+    SetBuffer(0, WORD_SIZE);
+}
+
+/****************************************************************************************
+ * Function Name:       SetBuffer
+ * Input Parameters:    int entries - represents the number of blocks the buffer holds
+ *                      (0 = no buffer)
+ *                      int blockSize - represents the block size in bytes
+ * Return Value:        void
+ * Purpose:             Creates an empty buffer and resets the coalesced write count
+ ***************************************************************************************/
+void WriteBuffer::SetBuffer(int entries, int blockSize) {
+    // Store User Settings
+    this->entries = entries;
+    this->blockSize = blockSize;
+
+    // A block smaller than a word is written as a whole
+    wordSize = min(WORD_SIZE, blockSize);
+    wordsPerBlock = blockSize / wordSize;
+
+    // Every entry empty
+    entryBlock.assign(entries, -1);
+    wordWritten.assign(entries * wordsPerBlock, false);
+    writtenWords.assign(entries, 0);
+    head = 0;
+    used = 0;
+
+    // Reset Counter
+    coalescedWrites = 0;
+}
+
+/****************************************************************************************
+ * Function Name:       Write
+ * Input Parameters:    Address address - represents the first main memory address
+ *                      written
+ *                      int bytes - represents the number of bytes written (a word or
+ *                      a whole block, never crossing a block)
+ * Return Value:        long long - represents the bytes sent to the next level to
+ *                      make room for the write
+ * Purpose:             Adds a write to the buffer, merging it into the block's entry
+ *                      if there is one
+ ***************************************************************************************/
+long long WriteBuffer::Write(Address address, int bytes) {
+    // Bytes drained to the next level
+    long long drained = 0;
+
+    // Main Memory Block Number = Main Memory Address / Block Size
+    Address block = address / blockSize;
+
+    // Search for the block's entry
+    int entry = -1;
+    for(int i=0; i < used; i++) {
+        int slot = (head + i) % entries;
+        if(entryBlock[slot] == block) {
+            entry = slot;
+            coalescedWrites++;
+            break;
+        }
+    }
+
+    // No entry, take the next one (Drain the oldest if the buffer is full)
+    if(entry < 0) {
+        if(used == entries) {
+            drained = Drain();
+        }
+        entry = (head + used) % entries;
+        entryBlock[entry] = block;
+        used++;
+    }
+
+    // Mark the written words
+    int firstWord = (int)(address % blockSize) / wordSize;
+    int words = max(bytes / wordSize, 1);
+    for(int w = firstWord; w < min(firstWord + words, wordsPerBlock); w++) {
+        if(!wordWritten[(entry * wordsPerBlock) + w]) {
+            wordWritten[(entry * wordsPerBlock) + w] = true;
+            writtenWords[entry]++;
+        }
+    }
+
+    return drained;
+}
+
+/****************************************************************************************
+ * Function Name:       Flush
+ * Input Parameters:    void
+ * Return Value:        long long - represents the bytes sent to the next level
+ * Purpose:             Drains every entry, as at the end of a simulation
+ ***************************************************************************************/
+long long WriteBuffer::Flush() {
+    // Drain oldest first until empty
+    long long drained = 0;
+    while(used > 0) {
+        drained += Drain();
+    }
+
+    return drained;
+}
+
+/****************************************************************************************
+ * Function Name:       GetCoalescedWrites
+ * Input Parameters:    void
+ * Return Value:        long long - represents the writes merged into an entry
+ * Purpose:             Returns how many writes cost no extra traffic
+ ***************************************************************************************/
+long long WriteBuffer::GetCoalescedWrites() {
+    // Return coalescedWrites
+    return coalescedWrites;
+}
+
+/****************************************************************************************
+ * Function Name:       Drain
+ * Input Parameters:    void
+ * Return Value:        long long - represents the bytes sent to the next level
+ * Purpose:             Writes the oldest entry's words to the next level and frees it
+ ***************************************************************************************/
+long long WriteBuffer::Drain() {
+    // Bytes of the written words
+    long long bytes = (long long)writtenWords[head] * wordSize;
+
+    // Clear the entry
+    for(int w=0; w < wordsPerBlock; w++) {
+        wordWritten[(head * wordsPerBlock) + w] = false;
+    }
+    writtenWords[head] = 0;
+    entryBlock[head] = -1;
+
+    // Next oldest entry
+    head = (head + 1) % entries;
+    used--;
+
+    return bytes;
+}
\ No newline at end of file
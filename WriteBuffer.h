@@ -0,0 +1,94 @@
+/****************************************************************************************
+ *  Memory Simulator: "WriteBuffer.h"
+ *
+ *  Author:     Hannah Perkins
+ *  CWID:       11472559
+ *  Assignment: Lab #7
+ *
+ *  Date:       17 October 2026
+ *  Course:     ECE 487
+ *
+ *  Function:   Simulates a coalescing write buffer between a cache and the next level
+ *
+ *  Description: Write Buffer Class that holds writes on their way from the cache to
+ *          the next level of memory. Each entry holds one block and remembers which
+ *          words of the block have been written. A write to a block that already has
+ *          an entry is merged into it (coalesced) and costs no extra traffic. A write
+ *          to a new block takes a free entry; if the buffer is full, the oldest entry
+ *          is first written to the next level (drained). Only the written words of a
+ *          drained entry are sent.
+ *
+ *          The trace gives an address but no size for each access, so one CPU write
+ *          is taken to be one word (WORD_SIZE bytes). A writeback of a dirty line
+ *          writes the whole block.
+ *
+ *          Entries are kept in a ring in the order they were taken. Write buffers
+ *          are small (a handful of entries), so entries are searched one by one.
+ *
+ ***************************************************************************************/
+
+#ifndef WRITEBUFFER_H
+#define WRITEBUFFER_H
+
+#include "Address.h"
+#include <vector>
+#include <algorithm>
+using namespace std;
+
+// Bytes written by one CPU write
+const int WORD_SIZE = 4;
+
+/****************************************************************************************
+ * Class Name:          WriteBuffer
+ * Purpose:             Merges writes to the same block before they reach the next level
+ ***************************************************************************************/
+class WriteBuffer {
+    public:
+        WriteBuffer();                              // Constructor
+
+        // User Functions
+        void SetBuffer(int entries, int blockSize);
+        long long Write(Address address, int bytes);
+        long long Flush();
+
+        // Getter Functions
+        int GetEntries();
+        long long GetCoalescedWrites();
+
+    private:
+        // Variables Set by User
+        int entries;
+        int blockSize;
+
+        // Variables Calculated and Set by Program
+        int wordSize;
+        int wordsPerBlock;
+
+        // Per Entry: block held, and which of its words were written
+        vector<Address> entryBlock;
+        vector<bool> wordWritten;               // wordsPerBlock bits per entry
+        vector<int> writtenWords;
+
+        // Ring of used entries (oldest at head)
+        int head;
+        int used;
+
+        // Writes merged into an existing entry
+        long long coalescedWrites;
+
+        // Helper Functions
+        long long Drain();
+};
+
+/****************************************************************************************
+ * Function Name:       GetEntries
+ * Input Parameters:    void
+ * Return Value:        int - represents the number of entries (0 = no buffer)
+ * Purpose:             Returns the size of the buffer
+ ***************************************************************************************/
+inline int WriteBuffer::GetEntries() {
+    // Return entries
+    return entries;
+}
+
+#endif
\ No newline at end of file